@@ -0,0 +1,449 @@
+/**
+ * Accuracy and throughput of the functions of numeric.hpp against those of
+ * cmath. Each function is swept over a few ranges of its argument for float,
+ * double and long double, from where it is typically called to where it is
+ * hard: near overflow and underflow, near its roots and poles, through the
+ * subnormals and out to huge arguments. For each sweep this reports the time
+ * per call of the scalar form, of cmath and of the batch form where there is
+ * one, the series iterations per call counted by the telemetry of series.hpp
+ * along with the most in any one call, and the error in units in the last
+ * place against cmath and against a more precise reference.
+ *
+ * The reference is a quad_double from expansion.hpp for the functions that
+ * it has to full precision, and otherwise the long double cmath, which only
+ * counts as a reference for float and double. Where the result is infinite
+ * or not a number in one and not the other it counts as a mismatch instead
+ * of an error.
+ *
+ * The densities and distribution functions of statistics.hpp are compiled
+ * here on duals as well, though not run, as a check that they instantiate.
+ *
+ * There is no build here, so build it with optimization, such as
+ *
+ *	g++ -std=c++20 -O3 -o benchmark benchmark.cpp
+ *
+ * and run it with --json to print the records for regression tracking, with
+ * --samples n for the points in each sweep (4096 by default), or with names
+ * of functions to sweep only those.
+ */
+
+#include "numeric.hpp"
+#include "dual.hpp"
+#include "expansion.hpp"
+#include "statistics.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <random>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+	using arithmetic::quad_double;
+
+	/// A reference value to more digits than long double holds, as hi + lo
+	struct exact
+	{
+		long double hi, lo = 0;
+		bool known = true;
+	};
+
+	/// No reference more precise than the type itself
+	constexpr exact unknown { 0, 0, false };
+
+	/// Whether x is zero or far enough inside the normal range of double for the arithmetic of a quad_double, whose splitting overflows near the top
+	bool safe(long double x)
+	{
+		const long double a = std::fabs(x);
+		return 0 == a or (0x1p-960L < a and a < 0x1p960L);
+	}
+
+	/// The reference of a quad_double
+	exact from(const quad_double &q)
+	{
+		const long double hi = static_cast<long double>(q);
+		return { hi, static_cast<long double>(q - quad_double(hi)) };
+	}
+
+	/// Arguments from [lo, hi], log uniform in magnitude if wide, with either sign if symmetric, or nearest to multiples k step of k in [lo, hi]
+	struct range
+	{
+		const char *name;
+		long double lo, hi;
+		bool wide = false, symmetric = false;
+		long double step = 0;
+	};
+
+	/// The largest x below which f(x) is finite, found by doubling and then halving
+	template <typename T, typename F> T finite_limit(F f)
+	{
+		T lo = 1, hi = 2;
+		while (std::isfinite(f(hi))) {
+		 lo = hi;
+		 hi *= 2;
+		}
+		for (int n = 0; n < std::numeric_limits<T>::digits; ++n) {
+		 const T mid = (lo + hi)/2;
+		 (std::isfinite(f(mid)) ? lo : hi) = mid;
+		}
+		return lo;
+	}
+
+	/// n arguments drawn from a range, each rounded to T and kept within its finite range
+	template <typename T> std::vector<T> sample(const range &r, std::size_t n, std::mt19937_64 &g)
+	{
+		using limits = std::numeric_limits<T>;
+		std::uniform_real_distribution<long double> u(0, 1);
+		std::vector<T> x(n);
+		for (auto &v : x) {
+		 long double t = u(g), y;
+		 if (0 < r.step) y = r.step*std::round(r.lo + t*(r.hi - r.lo));
+		 else if (r.wide) y = std::exp(std::log(r.lo) + t*(std::log(r.hi) - std::log(r.lo)));
+		 else y = r.lo + t*(r.hi - r.lo);
+		 if (r.symmetric and g() & 1) y = -y;
+		 v = static_cast<T>(std::clamp<long double>(y, limits::lowest(), limits::max()));
+		}
+		return x;
+	}
+
+	/// The error of y against r in units in the last place of T at r
+	template <typename T> double ulps(T y, const exact &r)
+	{
+		using limits = std::numeric_limits<T>;
+		int e = limits::min_exponent;
+		if (0 != r.hi) {
+		 std::frexp(r.hi, &e);
+		 e = std::max(e, limits::min_exponent);
+		}
+		return static_cast<double>(std::fabs((static_cast<long double>(y) - r.hi) - r.lo)/std::ldexp(1.0L, e - limits::digits));
+	}
+
+	/// Largest and mean error over the points where both are finite, counting those where they are not alike
+	struct error
+	{
+		double most = 0, sum = 0;
+		std::size_t count = 0, mismatches = 0;
+		long double worst = 0;
+
+		template <typename T> void add(T x, T y, const exact &r)
+		{
+			if (not r.known) return;
+			// The reference is rounded to T to see whether it is out of range there
+			const T t = static_cast<T>(r.hi);
+			if (not std::isfinite(t) or not std::isfinite(y)) {
+			 const bool alike = std::isnan(t) ? std::isnan(y) : t == y;
+			 if (not alike) ++mismatches;
+			 return;
+			}
+			const double u = ulps(y, r);
+			if (most < u) {
+			 most = u;
+			 worst = x;
+			}
+			sum += u;
+			++count;
+		}
+
+		double mean() const
+		{
+			return count ? sum/count : 0;
+		}
+	};
+
+	/// The measurements of one function over one range for one type
+	struct record
+	{
+		std::string function, type, range;
+		std::size_t samples;
+		double numeric_ns, cmath_ns, batch_ns;
+		double iterations, most;
+		error cmath, reference;
+	};
+
+	/// Nanoseconds per point of a pass over n points, repeated until some milliseconds have gone by
+	template <typename P> double time(P pass, std::size_t n)
+	{
+		using clock = std::chrono::steady_clock;
+		const auto start = clock::now();
+		std::chrono::duration<double, std::nano> t;
+		std::size_t passes = 0;
+		do {
+		 pass();
+		 ++passes;
+		 t = clock::now() - start;
+		} while (t.count() < 2e7);
+		return t.count()/(passes*n);
+	}
+
+	/// Sweeps f, its cmath counterpart g and its batch form b (or nullptr) over the points x and p, checking both against the reference
+	template <typename T, typename F, typename G, typename B, typename R>
+	record measure(const char *function, const char *type, const range &r, const range &q, std::size_t n, F f, G g, B b, R reference)
+	{
+		std::mt19937_64 random(n);
+		const std::vector<T> x = sample<T>(r, n, random), p = sample<T>(q, n, random);
+		std::vector<T> y(n), z(n);
+		record s { function, type, r.name, n, 0, 0, NAN, 0, 0, { }, { } };
+
+		// The iterations are counted on a pass of their own, out of the timing
+		numeric::histogram h;
+		{
+			numeric::monitor m(h);
+			for (std::size_t i = 0; i < n; ++i) y[i] = f(x[i], p[i]);
+		}
+		s.iterations = static_cast<double>(h.iterations.load())/n;
+		s.most = h.most.load();
+
+		for (std::size_t i = 0; i < n; ++i) {
+		 const long double c = g(x[i], p[i]);
+		 s.cmath.add(x[i], y[i], exact { c });
+		 s.reference.add(x[i], y[i], reference(x[i], p[i], c));
+		}
+
+		s.numeric_ns = time([&] { for (std::size_t i = 0; i < n; ++i) y[i] = f(x[i], p[i]); }, n);
+		s.cmath_ns = time([&] { for (std::size_t i = 0; i < n; ++i) z[i] = g(x[i], p[i]); }, n);
+		if constexpr (not std::is_same_v<B, std::nullptr_t>) {
+			s.batch_ns = time([&] { b(std::span<const T>(x), std::span<const T>(p), std::span<T>(y)); }, n);
+		}
+		return s;
+	}
+
+	/// A sweep to be run for some number of points
+	struct job
+	{
+		std::string function;
+		std::function<record(std::size_t)> run;
+	};
+
+	/// The batch form b where T has one, otherwise none
+	template <typename T, typename B> auto batch(B b)
+	{
+		if constexpr (std::is_same_v<T, long double>) return nullptr;
+		else return b;
+	}
+
+	/// The long double cmath as the reference, which is only more precise than T for float and double
+	template <typename T, typename F> auto libm(F f)
+	{
+		return [f](T x, T p, long double) {
+			if constexpr (std::is_same_v<T, long double>) return unknown;
+			else return exact { f(static_cast<long double>(x), static_cast<long double>(p)) };
+		};
+	}
+
+	/// A quad_double function as the reference, where its arguments and the value of cmath c are safe
+	template <typename T, typename F> auto quad(F f)
+	{
+		return [f](T x, T p, long double c) { return safe(x) and safe(p) and safe(c) ? from(f(quad_double(x), quad_double(p))) : unknown; };
+	}
+
+	/// All the sweeps for type T
+	template <typename T> void sweeps(std::vector<job> &jobs, const char *type)
+	{
+		using limits = std::numeric_limits<T>;
+		const long double max = limits::max(), min = limits::min(), tiny = limits::denorm_min();
+		const long double top = finite_limit<T>([](T x) { return std::exp(x); });
+		const long double gamma_top = finite_limit<T>([](T x) { return std::tgamma(x); });
+		const long double erfc_top = finite_limit<T>([](T x) { return 1/std::erfc(x); });
+		const long double bottom = std::log(min) - limits::digits*std::log(2.0L);
+		const range none { "", 0, 1 };
+
+		// The batch form of one argument taking the points p as well, or none
+		const auto lift = [](auto b) {
+			if constexpr (std::is_same_v<decltype(b), std::nullptr_t>) return nullptr;
+			else return batch<T>([b](auto x, auto, auto y) { b(x, y); });
+		};
+
+		// Each function of one argument, ignoring the second, in its numeric, cmath and batch forms with the reference
+		const auto unary = [&](const char *name, std::vector<range> ranges, auto f, auto g, auto b, auto reference) {
+			for (const auto &r : ranges) {
+			 jobs.push_back({ name, [=](std::size_t n) {
+			  return measure<T>(name, type, r, none, n,
+			   [f](T x, T) { return f(x); },
+			   [g](T x, T) { return g(x); },
+			   lift(b),
+			   reference);
+			 } });
+			}
+		};
+		const auto binary = [&](const char *name, std::vector<range> ranges, range q, auto f, auto g, auto b, auto reference) {
+			for (const auto &r : ranges) {
+			 jobs.push_back({ name, [=](std::size_t n) { return measure<T>(name, type, r, q, n, f, g, batch<T>(b), reference); } });
+			}
+		};
+
+		unary("exp", { { "[-1, 1]", -1, 1 }, { "[-20, 20]", -20, 20 }, { "overflow", top - 10, top + 1 }, { "underflow", bottom, std::log(min) + 1 } },
+			[](T x) { return numeric::exp(x); }, [](T x) { return std::exp(x); }, [](auto x, auto y) { numeric::exp(x, y); },
+			quad<T>([](quad_double x, quad_double) { return arithmetic::exp(x); }));
+		unary("expm1", { { "tiny", 1e-30L, 1e-3L, true, true }, { "[-1, 1]", -1, 1 }, { "[-40, 40]", -40, 40 } },
+			[](T x) { return numeric::expm1(x); }, [](T x) { return std::expm1(x); }, [](auto x, auto y) { numeric::expm1(x, y); },
+			quad<T>([](quad_double x, quad_double) { return arithmetic::exp(x) - 1; }));
+		unary("exp2", { { "[-10, 10]", -10, 10 }, { "overflow", T(limits::max_exponent - 8), T(limits::max_exponent) } },
+			[](T x) { return numeric::exp2(x); }, [](T x) { return std::exp2(x); }, [](auto x, auto y) { numeric::exp2(x, y); },
+			quad<T>([](quad_double x, quad_double) { return arithmetic::exp(x*arithmetic::expansion_ln2<4>); }));
+		unary("ln", { { "[0.5, 2]", 0.5, 2 }, { "near 1", 1 - 1e-6L, 1 + 1e-6L }, { "normal", min, max, true }, { "subnormal", tiny, min, true } },
+			[](T x) { return numeric::ln(x); }, [](T x) { return std::log(x); }, [](auto x, auto y) { numeric::ln(x, y); },
+			quad<T>([](quad_double x, quad_double) { return arithmetic::ln(x); }));
+		unary("log1p", { { "tiny", 1e-30L, 1e-3L, true, true }, { "[-0.5, 1]", -0.5, 1 }, { "wide", 1, max, true } },
+			[](T x) { return numeric::log1p(x); }, [](T x) { return std::log1p(x); }, nullptr,
+			quad<T>([](quad_double x, quad_double) { return arithmetic::ln(1 + x); }));
+		unary("log2", { { "normal", min, max, true } },
+			[](T x) { return numeric::log2(x); }, [](T x) { return std::log2(x); }, [](auto x, auto y) { numeric::log2(x, y); },
+			quad<T>([](quad_double x, quad_double) { return arithmetic::ln(x)/arithmetic::expansion_ln2<4>; }));
+		unary("log10", { { "normal", min, max, true } },
+			[](T x) { return numeric::log10(x); }, [](T x) { return std::log10(x); }, [](auto x, auto y) { numeric::log10(x, y); },
+			quad<T>([](quad_double x, quad_double) { return arithmetic::ln(x)/arithmetic::ln(quad_double(10)); }));
+		unary("sqrt", { { "normal", min, max, true } },
+			[](T x) { return numeric::sqrt(x); }, [](T x) { return std::sqrt(x); }, nullptr,
+			quad<T>([](quad_double x, quad_double) { return arithmetic::sqrt(x); }));
+
+		// The quad_double reduction by pi/2 is only exact for moderate arguments, so beyond 1e15 the reference is cmath
+		const auto sin = [](quad_double x, quad_double) { return arithmetic::sincos(x)[0]; };
+		const auto cos = [](quad_double x, quad_double) { return arithmetic::sincos(x)[1]; };
+		const auto tan = [](quad_double x, quad_double) { const auto c = arithmetic::sincos(x); return c[0]/c[1]; };
+		const std::vector<range> turns = { { "[-pi, pi]", -numeric::pi, numeric::pi }, { "k pi/2", 1, 1e6L, false, false, numeric::pi_2 }, { "[1e6, 1e15]", 1e6L, 1e15L, true, true } };
+		unary("sin", turns, [](T x) { return numeric::sin(x); }, [](T x) { return std::sin(x); }, [](auto x, auto y) { numeric::sin(x, y); }, quad<T>(sin));
+		unary("cos", turns, [](T x) { return numeric::cos(x); }, [](T x) { return std::cos(x); }, [](auto x, auto y) { numeric::cos(x, y); }, quad<T>(cos));
+		unary("tan", turns, [](T x) { return numeric::tan(x); }, [](T x) { return std::tan(x); }, [](auto x, auto y) { numeric::tan(x, y); }, quad<T>(tan));
+		unary("sin", { { "huge", 1e15L, max, true, true } }, [](T x) { return numeric::sin(x); }, [](T x) { return std::sin(x); }, [](auto x, auto y) { numeric::sin(x, y); },
+			libm<T>([](long double x, long double) { return std::sin(x); }));
+
+		const std::vector<range> unit = { { "[-1, 1]", -1, 1 }, { "near 1", 1 - 1e-6L, 1, false, true } };
+		unary("asin", unit, [](T x) { return numeric::asin(x); }, [](T x) { return std::asin(x); }, [](auto x, auto y) { numeric::asin(x, y); },
+			quad<T>([](quad_double x, quad_double) { return numeric::asin(x); }));
+		unary("acos", unit, [](T x) { return numeric::acos(x); }, [](T x) { return std::acos(x); }, [](auto x, auto y) { numeric::acos(x, y); },
+			quad<T>([](quad_double x, quad_double) { return numeric::acos(x); }));
+		unary("atan", { { "[-1, 1]", -1, 1 }, { "wide", 1e-30L, 1e30L, true, true } },
+			[](T x) { return numeric::atan(x); }, [](T x) { return std::atan(x); }, [](auto x, auto y) { numeric::atan(x, y); },
+			quad<T>([](quad_double x, quad_double) { return numeric::atan(x); }));
+		binary("atan2", { { "wide", 1e-30L, 1e30L, true, true } }, { "", 1e-30L, 1e30L, true, true },
+			[](T y, T x) { return numeric::atan2(y, x); }, [](T y, T x) { return std::atan2(y, x); }, [](auto y, auto x, auto z) { numeric::atan2(y, x, z); },
+			quad<T>([](quad_double y, quad_double x) { return numeric::atan2(y, x); }));
+
+		const std::vector<range> hyperbolic = { { "tiny", 1e-20L, 1e-3L, true, true }, { "[-20, 20]", -20, 20 }, { "overflow", top - 2, top + 1, false, true } };
+		unary("sinh", hyperbolic, [](T x) { return numeric::sinh(x); }, [](T x) { return std::sinh(x); }, [](auto x, auto y) { numeric::sinh(x, y); },
+			libm<T>([](long double x, long double) { return std::sinh(x); }));
+		unary("cosh", hyperbolic, [](T x) { return numeric::cosh(x); }, [](T x) { return std::cosh(x); }, [](auto x, auto y) { numeric::cosh(x, y); },
+			libm<T>([](long double x, long double) { return std::cosh(x); }));
+		unary("tanh", hyperbolic, [](T x) { return numeric::tanh(x); }, [](T x) { return std::tanh(x); }, [](auto x, auto y) { numeric::tanh(x, y); },
+			libm<T>([](long double x, long double) { return std::tanh(x); }));
+		unary("asinh", { { "tiny", 1e-20L, 1e-3L, true, true }, { "wide", 1e-3L, max, true, true } },
+			[](T x) { return numeric::asinh(x); }, [](T x) { return std::asinh(x); }, [](auto x, auto y) { numeric::asinh(x, y); },
+			libm<T>([](long double x, long double) { return std::asinh(x); }));
+		unary("acosh", { { "near 1", 1, 1 + 1e-6L }, { "wide", 1, max, true } },
+			[](T x) { return numeric::acosh(x); }, [](T x) { return std::acosh(x); }, [](auto x, auto y) { numeric::acosh(x, y); },
+			libm<T>([](long double x, long double) { return std::acosh(x); }));
+		unary("atanh", unit, [](T x) { return numeric::atanh(x); }, [](T x) { return std::atanh(x); }, [](auto x, auto y) { numeric::atanh(x, y); },
+			libm<T>([](long double x, long double) { return std::atanh(x); }));
+
+		binary("pow", { { "[0.1, 10]", 0.1L, 10 } }, { "", -20, 20 },
+			[](T x, T p) { return numeric::pow(x, p); }, [](T x, T p) { return std::pow(x, p); }, [](auto x, auto p, auto y) { numeric::pow(x, p, y); },
+			quad<T>([](quad_double x, quad_double p) { return arithmetic::exp(p*arithmetic::ln(x)); }));
+
+		unary("erf", { { "tiny", 1e-20L, 1e-3L, true, true }, { "[-6, 6]", -6, 6 } },
+			[](T x) { return numeric::erf(x); }, [](T x) { return std::erf(x); }, [](auto x, auto y) { numeric::erf(x, y); },
+			libm<T>([](long double x, long double) { return std::erf(x); }));
+		unary("erfc", { { "[-6, 6]", -6, 6 }, { "underflow", erfc_top/2, erfc_top + 1 } },
+			[](T x) { return numeric::erfc(x); }, [](T x) { return std::erfc(x); }, [](auto x, auto y) { numeric::erfc(x, y); },
+			libm<T>([](long double x, long double) { return std::erfc(x); }));
+		unary("tgamma", { { "[0.5, 10]", 0.5, 10 }, { "negative", -20, 0 }, { "overflow", gamma_top/2, gamma_top + 1 } },
+			[](T x) { return numeric::tgamma(x); }, [](T x) { return std::tgamma(x); }, [](auto x, auto y) { numeric::tgamma(x, y); },
+			libm<T>([](long double x, long double) { return std::tgamma(x); }));
+		unary("lgamma", { { "roots", 0.9L, 2.1L }, { "negative", -20, 0 }, { "wide", 3, max/1e10L, true } },
+			[](T x) { return numeric::lgamma(x); }, [](T x) { return std::lgamma(x); }, [](auto x, auto y) { numeric::lgamma(x, y); },
+			libm<T>([](long double x, long double) { return std::lgamma(x); }));
+	}
+
+	/// A number for JSON, where NaN (no measurement) is null
+	void number(const char *key, double v, const char *end = ", ")
+	{
+		if (std::isnan(v)) std::printf("\"%s\": null%s", key, end);
+		else std::printf("\"%s\": %.6g%s", key, v, end);
+	}
+
+	void json(const record &r, bool last)
+	{
+		std::printf("  { \"function\": \"%s\", \"type\": \"%s\", \"range\": \"%s\", \"samples\": %zu, ", r.function.c_str(), r.type.c_str(), r.range.c_str(), r.samples);
+		number("numeric_ns", r.numeric_ns);
+		number("cmath_ns", r.cmath_ns);
+		number("batch_ns", r.batch_ns);
+		number("iterations", r.iterations);
+		number("most_iterations", r.most);
+		number("cmath_max_ulp", r.cmath.most);
+		number("cmath_mean_ulp", r.cmath.mean());
+		std::printf("\"cmath_mismatches\": %zu, ", r.cmath.mismatches);
+		const bool known = r.reference.count or r.reference.mismatches;
+		number("reference_max_ulp", known ? r.reference.most : NAN);
+		number("reference_mean_ulp", known ? r.reference.mean() : NAN);
+		std::printf("\"reference_mismatches\": %zu, ", r.reference.mismatches);
+		// The argument may be beyond the range of double, which JSON does not limit
+		std::printf("\"worst\": %.10Lg }%s\n", known ? r.reference.worst : r.cmath.worst, last ? "" : ",");
+	}
+
+	void text(const record &r)
+	{
+		const bool known = r.reference.count or r.reference.mismatches;
+		std::printf("%-7s %-12s %-12s %9.2f %9.2f ", r.function.c_str(), r.type.c_str(), r.range.c_str(), r.numeric_ns, r.cmath_ns);
+		if (std::isnan(r.batch_ns)) std::printf("%9s ", "-");
+		else std::printf("%9.2f ", r.batch_ns);
+		std::printf("%8.1f %6.0f %9.3g %8.3g %4zu ", r.iterations, r.most, r.cmath.most, r.cmath.mean(), r.cmath.mismatches);
+		if (known) std::printf("%9.3g %8.3g %4zu %12.6Lg\n", r.reference.most, r.reference.mean(), r.reference.mismatches, r.reference.worst);
+		else std::printf("%9s %8s %4s %12.6Lg\n", "-", "-", "-", r.cmath.worst);
+	}
+
+	/// Every density and distribution function of statistics.hpp on duals, compiled though not run, so that this build breaks where they do
+	[[maybe_unused]] void duals()
+	{
+		using statistics::dnorm, statistics::pnorm, statistics::dgamma, statistics::pgamma, statistics::dexp, statistics::pexp;
+		using statistics::dchisq, statistics::pchisq, statistics::dbeta, statistics::pbeta, statistics::df, statistics::pf;
+		using D = numeric::dual<double, 2>;
+		const D x = D::variable(0.5, 0), a = D::variable(2, 1), b = 3;
+		const D y[] = {
+			dnorm(x), dnorm(x, a, b, true), pnorm(x), pnorm(x, a, b, false, true),
+			dgamma(x, a, b), dgamma(x, a, b, true), pgamma(x, a, b), pgamma(x, a, b, false, true),
+			dexp(x), dexp(x, a, true), pexp(x), pexp(x, a, false, true),
+			dchisq(x, a), dchisq(x, a, true), pchisq(x, a), pchisq(x, a, false, true),
+			dbeta(x, a, b), dbeta(x, a, b, true), pbeta(x, a, b), pbeta(x, a, b, false, true),
+			df(x, a, b), df(x, a, b, true), pf(x, a, b), pf(x, a, b, false, true)
+		};
+		for (const D &z : y) std::printf("%g %g %g\n", z.value(), z.derivative(0), z.derivative(1));
+	}
+
+}; // namespace
+
+int main(int argc, char **argv)
+{
+	bool as_json = false;
+	std::size_t samples = 4096;
+	std::vector<std::string> only;
+	for (int i = 1; i < argc; ++i) {
+	 if (0 == std::strcmp(argv[i], "--json")) as_json = true;
+	 else if (0 == std::strcmp(argv[i], "--samples") and i + 1 < argc) samples = std::strtoul(argv[++i], nullptr, 10);
+	 else only.push_back(argv[i]);
+	}
+
+	std::vector<job> jobs;
+	sweeps<float>(jobs, "float");
+	sweeps<double>(jobs, "double");
+	sweeps<long double>(jobs, "long double");
+	std::erase_if(jobs, [&](const job &j) { return not only.empty() and std::find(only.begin(), only.end(), j.function) == only.end(); });
+
+	if (as_json) std::printf("[\n");
+	else std::printf("%-7s %-12s %-12s %9s %9s %9s %8s %6s %9s %8s %4s %9s %8s %4s %12s\n",
+		"", "type", "range", "ns", "cmath ns", "batch ns", "iter", "most", "cmath max", "mean", "bad", "ref max", "mean", "bad", "worst x");
+	for (std::size_t i = 0; i < jobs.size(); ++i) {
+	 const record r = jobs[i].run(samples);
+	 if (as_json) json(r, i + 1 == jobs.size());
+	 else text(r);
+	 std::fflush(stdout);
+	}
+	if (as_json) std::printf("]\n");
+	return 0;
+}
@@ -0,0 +1,264 @@
+#ifndef chebyshev_hpp
+#define chebyshev_hpp
+
+/**
+ * Chebyshev approximation of any function on a fixed interval. Functions
+ * from numeric.hpp or statistics.hpp that are called over and over with the
+ * same parameters, such as pgamma for one shape across millions of points,
+ * are worth sampling once and replacing with a polynomial whose evaluation
+ * is a few dozen multiply-adds rather than a series of thousands of flops.
+ *
+ * The function is interpolated at the Chebyshev nodes of the first kind,
+ * which avoids the endpoints, and the coefficients come from the discrete
+ * cosine transform of the samples. For a smooth function they fall away
+ * geometrically, so once the last of them are below the tolerance the rest
+ * of the series can be cut off. Where they do not fall fast enough in the
+ * largest degree allowed the piece is halved and each half sampled again,
+ * so the pieces are only small where the function is hard, such as near a
+ * singularity at an end. A piece that has still not converged at the deepest
+ * level is kept as it is, and the series says so. All pieces are kept to the
+ * same degree, the most that any of them needs, and a table over the
+ * smallest of them finds the piece of a point by one multiplication.
+ *
+ * The series is summed by Clenshaw's recurrence, which is as stable as the
+ * direct sum but needs no powers or cosines. The batch form runs a block of
+ * points through the recurrence together, one lane each, so it vectorizes
+ * with gathers of the coefficients. Outside of the interval the end pieces
+ * are extrapolated, which is not accurate for long.
+ *
+ * The tolerance is relative to the largest magnitude of the function on the
+ * interval, so near its zeros the error is absolute rather than relative.
+ * The error reported is measured against the function midway between the
+ * nodes of each piece and at its ends, where the interpolant strays
+ * furthest, since the coefficients cut off do not account for those folded
+ * into the rest.
+ */
+
+#include "numeric.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace numeric
+{
+	/// Sums c[k] T_k(u) by Clenshaw's recurrence, taking c[0] to be already halved
+	template <typename num_t> constexpr num_t clenshaw(std::span<const num_t> c, num_t u)
+	{
+		num_t b1 = 0, b2 = 0;
+		const num_t v = 2*u;
+		for (std::size_t k = c.size() - 1; k > 0; --k) {
+		 const num_t b0 = c[k] + v*b1 - b2;
+		 b2 = b1;
+		 b1 = b0;
+		}
+		return c[0] + u*b1 - b2;
+	}
+
+	/// Piecewise Chebyshev series of a function on [lo, hi]
+	template <typename num_t> class chebyshev
+	{
+		num_t lo, scale, err = 0;
+		std::size_t order = 1;
+		bool whole = true;
+		std::vector<std::uint32_t> cells;
+		std::vector<num_t> mid, inverse, c;
+
+		/// Points evaluated together by the batch form, one lane each, enough that the lanes are not unrolled
+		static constexpr std::size_t block = 64;
+
+		/// The coefficients of f on [a, b] from its values at n nodes, with the first halved, and the largest value
+		template <typename function> static num_t fit(function &f, num_t a, num_t b, std::size_t n, num_t *d)
+		{
+			std::vector<num_t> y(n), t(n);
+			num_t m = 0;
+			const num_t centre = (a + b)/2, half = (b - a)/2;
+			for (std::size_t k = 0; k < n; ++k) {
+			 t[k] = cos(num_t(pi)*(k + num_t(0.5))/n);
+			 y[k] = f(centre + half*t[k]);
+			 m = std::max(m, abs(y[k]));
+			}
+			// d[j] = 2/n sum of y[k] T_j(t[k]), with T_j by the three term recurrence
+			std::vector<num_t> p(n, 1), q(t);
+			for (std::size_t j = 0; j < n; ++j) {
+			 num_t s = 0;
+			 for (std::size_t k = 0; k < n; ++k) s += y[k]*(0 == j ? p[k] : q[k]);
+			 d[j] = s*2/n;
+			 if (0 < j) {
+			  for (std::size_t k = 0; k < n; ++k) {
+			   const num_t r = 2*t[k]*q[k] - p[k];
+			   p[k] = q[k];
+			   q[k] = r;
+			  }
+			 }
+			}
+			d[0] /= 2;
+			return m;
+		}
+
+		/// The number of leading coefficients whose tail sums to no more than e, or 0 if the tail has not yet fallen below it
+		static std::size_t cut(const num_t *d, std::size_t n, num_t e)
+		{
+			if (e/4 < abs(d[n - 1]) + abs(d[n - 2])) return 0;
+			num_t s = 0;
+			std::size_t m = n;
+			while (1 < m and s + abs(d[m - 1]) <= e/2) s += abs(d[--m]);
+			return m;
+		}
+
+		/// Index of the piece holding x, with the position of x on the piece, which is in [-1, 1] within the interval
+		num_t locate(num_t x, std::size_t &i) const
+		{
+			const num_t t = std::clamp<num_t>((x - lo)*scale, 0, num_t(cells.size() - 1));
+			i = cells[static_cast<std::size_t>(t)];
+			return (x - mid[i])*inverse[i];
+		}
+
+	public:
+
+		/// Samples f on [lo, hi], halving the pieces of at most the given degree until tol is met relative to the largest magnitude of f
+		template <typename function>
+		chebyshev(function f, num_t lo, num_t hi, num_t tol = num_t(128*epsilon<num_t>), std::size_t degree = 32, unsigned depth = 12)
+		: lo(lo)
+		{
+			// The cut looks at the last two coefficients
+			if (degree < 1) throw std::invalid_argument(__func__);
+			struct piece
+			{
+				num_t a, b;
+				unsigned depth;
+				std::size_t m;
+			};
+			const std::size_t n = degree + 1;
+			std::vector<piece> todo { { lo, hi, 0, 0 } }, done;
+			std::vector<num_t> d, e(n);
+			num_t top = 0;
+			unsigned deepest = 0;
+			// Depth first from the left, so the pieces come out in order
+			while (not todo.empty()) {
+			 piece p = todo.back();
+			 todo.pop_back();
+			 top = std::max(top, fit(f, p.a, p.b, n, e.data()));
+			 p.m = cut(e.data(), n, tol*top);
+			 if (0 == p.m and p.depth < depth) {
+			  const num_t h = (p.a + p.b)/2;
+			  todo.push_back({ h, p.b, p.depth + 1, 0 });
+			  todo.push_back({ p.a, h, p.depth + 1, 0 });
+			  continue;
+			 }
+			 // Where the series did not converge by the deepest level all of it is kept
+			 if (0 == p.m) {
+			  p.m = n;
+			  whole = false;
+			 }
+			 deepest = std::max(deepest, p.depth);
+			 done.push_back(p);
+			 d.insert(d.end(), e.begin(), e.end());
+			}
+			// Keep the pieces to one degree, the largest that any of them needs
+			for (const auto &p : done) order = std::max(order, p.m);
+			c.resize(done.size()*order);
+			for (std::size_t i = 0; i < done.size(); ++i) {
+			 const auto &p = done[i];
+			 mid.push_back((p.a + p.b)/2);
+			 inverse.push_back(2/(p.b - p.a));
+			 cells.insert(cells.end(), std::size_t(1) << (deepest - p.depth), static_cast<std::uint32_t>(i));
+			 num_t s = 0;
+			 for (std::size_t k = 0; k < order; ++k) c[i*order + k] = d[i*n + k];
+			 for (std::size_t k = order; k < n; ++k) s += abs(d[i*n + k]);
+			 err = std::max(err, s);
+			 // Midway between the nodes and at the ends, which is where the error of the interpolant peaks
+			 const std::span<const num_t> q(c.data() + i*order, order);
+			 for (std::size_t k = 0; k <= n; ++k) {
+			  const num_t t = cos(num_t(pi)*k/n);
+			  err = std::max(err, abs(f(mid[i] + t/inverse[i]) - clenshaw(q, t)));
+			 }
+			}
+			scale = cells.size()/(hi - lo);
+		}
+
+		/// The approximation at x
+		num_t operator()(num_t x) const
+		{
+			std::size_t i;
+			const num_t u = locate(x, i);
+			return clenshaw(std::span<const num_t>(c.data() + i*order, order), u);
+		}
+
+		/// The approximation at each of x into y
+		numeric_clones void operator()(std::span<const num_t> x, std::span<num_t> y) const
+		{
+			const std::size_t n = std::min(x.size(), y.size());
+			std::size_t j = 0;
+			for (; j + block <= n; j += block) {
+			 std::size_t at[block];
+			 num_t u[block], v[block], b1[block] = { }, b2[block] = { };
+			 bool same = true;
+			 for (std::size_t l = 0; l < block; ++l) {
+			  std::size_t i;
+			  u[l] = locate(x[j + l], i);
+			  v[l] = 2*u[l];
+			  at[l] = i*order;
+			  same = same and at[l] == at[0];
+			 }
+			 if (same) {
+			  // All on one piece, as is usual for sorted points, so the coefficients are broadcast
+			  const num_t *p = c.data() + at[0];
+			  for (std::size_t k = order - 1; k > 0; --k) {
+			   for (std::size_t l = 0; l < block; ++l) {
+			    const num_t b0 = p[k] + v[l]*b1[l] - b2[l];
+			    b2[l] = b1[l];
+			    b1[l] = b0;
+			   }
+			  }
+			 } else {
+			  // Otherwise each lane gathers the coefficients of its own piece
+			  for (std::size_t k = order - 1; k > 0; --k) {
+			   for (std::size_t l = 0; l < block; ++l) {
+			    const num_t b0 = c[at[l] + k] + v[l]*b1[l] - b2[l];
+			    b2[l] = b1[l];
+			    b1[l] = b0;
+			   }
+			  }
+			 }
+			 for (std::size_t l = 0; l < block; ++l) y[j + l] = c[at[l]] + u[l]*b1[l] - b2[l];
+			}
+			for (; j < n; ++j) y[j] = (*this)(x[j]);
+		}
+
+		/// The largest error measured between the nodes, or the sum of the magnitudes of the coefficients cut off where that is larger
+		num_t error() const
+		{
+			return err;
+		}
+
+		/// Whether every piece met the tolerance before the deepest level
+		bool converged() const
+		{
+			return whole;
+		}
+
+		/// The number of pieces the interval was cut into
+		std::size_t size() const
+		{
+			return mid.size();
+		}
+
+		/// The degree of the polynomial on each piece
+		std::size_t degree() const
+		{
+			return order - 1;
+		}
+
+		/// The coefficients of the pieces, one after the other, each first coefficient halved
+		std::span<const num_t> coefficients() const
+		{
+			return c;
+		}
+	};
+
+}; // namespace
+
+#endif // file
@@ -0,0 +1,311 @@
+#ifndef dual_hpp
+#define dual_hpp
+
+/**
+ * Dual numbers for forward mode automatic differentiation. A dual holds a
+ * value along with its derivatives in N directions, and every operation on
+ * it carries the derivatives along by the chain rule. Seed the variables of
+ * a function with unit derivatives, evaluate it once, and the result holds
+ * its value and its whole gradient, exactly to the rounding of the value.
+ * The derivatives are packed into an array which the loops run across as
+ * one, so the compiler vectorizes them and N directions cost much less than
+ * N evaluations, or the 2N + 1 of central differences.
+ *
+ * A dual of duals is a hyper-dual number, whose outer derivative of the
+ * inner derivative is the second derivative, so it gives a Hessian without
+ * the cancellation of differencing twice.
+ *
+ * The templates of numeric.hpp run on duals unchanged since they need only
+ * the arithmetic and rounding to an integer, which is flat between its steps
+ * and so has zero derivatives. The elementary functions and those of the gamma family are
+ * overloaded here so that their derivatives are known analytically rather
+ * than carried through the terms of a series, which would only be as good
+ * as the point at which the value stopped the series. The duals live in the
+ * numeric namespace so that these overloads are found from inside the other
+ * templates as well as by qualified calls. Comparisons see only the values,
+ * so branches are taken on them.
+ */
+
+#include "numeric.hpp"
+#include <array>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+
+namespace numeric
+{
+	/// A value with its derivatives in N directions
+	template <typename num_t, std::size_t N = 1> class dual
+	{
+		num_t v = 0;
+		std::array<num_t, N> d { };
+
+	public:
+
+		constexpr dual() = default;
+
+		/// A constant, whose derivatives are all zero
+		template <typename value_t> requires std::convertible_to<value_t, num_t>
+		constexpr dual(const value_t &x) : v(x)
+		{ }
+
+		constexpr dual(const num_t &x, const std::array<num_t, N> &g) : v(x), d(g)
+		{ }
+
+		/// The independent variable of direction i, taking the value x
+		static constexpr dual variable(const num_t &x, std::size_t i = 0)
+		{
+			dual r = x;
+			r.d[i] = 1;
+			return r;
+		}
+
+		constexpr const num_t &value() const
+		{
+			return v;
+		}
+
+		/// The derivative in direction i
+		constexpr const num_t &derivative(std::size_t i = 0) const
+		{
+			return d[i];
+		}
+
+		constexpr const std::array<num_t, N> &gradient() const
+		{
+			return d;
+		}
+
+		constexpr explicit operator bool() const
+		{
+			return v != 0;
+		}
+
+		/// The function of this whose value is f and derivative df, by the chain rule
+		constexpr dual chain(const num_t &f, const num_t &df) const
+		{
+			dual r = f;
+			for (std::size_t i = 0; i < N; ++i) r.d[i] = df*d[i];
+			return r;
+		}
+
+		constexpr dual operator-() const
+		{
+			dual r;
+			r.v = -v;
+			for (std::size_t i = 0; i < N; ++i) r.d[i] = -d[i];
+			return r;
+		}
+
+		constexpr dual operator+() const
+		{
+			return *this;
+		}
+
+		constexpr dual &operator+=(const dual &b)
+		{
+			v += b.v;
+			for (std::size_t i = 0; i < N; ++i) d[i] += b.d[i];
+			return *this;
+		}
+
+		constexpr dual &operator-=(const dual &b)
+		{
+			v -= b.v;
+			for (std::size_t i = 0; i < N; ++i) d[i] -= b.d[i];
+			return *this;
+		}
+
+		constexpr dual &operator*=(const dual &b)
+		{
+			for (std::size_t i = 0; i < N; ++i) d[i] = d[i]*b.v + v*b.d[i];
+			v *= b.v;
+			return *this;
+		}
+
+		constexpr dual &operator/=(const dual &b)
+		{
+			// (u/w)' = (u' - (u/w) w')/w
+			const num_t r = 1/b.v;
+			const num_t q = v/b.v;
+			for (std::size_t i = 0; i < N; ++i) d[i] = (d[i] - q*b.d[i])*r;
+			v = q;
+			return *this;
+		}
+
+		constexpr dual &operator++()
+		{
+			++v;
+			return *this;
+		}
+
+		constexpr dual &operator--()
+		{
+			--v;
+			return *this;
+		}
+
+		constexpr dual operator++(int)
+		{
+			const dual r = *this;
+			++v;
+			return r;
+		}
+
+		constexpr dual operator--(int)
+		{
+			const dual r = *this;
+			--v;
+			return r;
+		}
+
+		friend constexpr dual operator+(dual a, const dual &b)
+		{
+			return a += b;
+		}
+
+		friend constexpr dual operator-(dual a, const dual &b)
+		{
+			return a -= b;
+		}
+
+		friend constexpr dual operator*(dual a, const dual &b)
+		{
+			return a *= b;
+		}
+
+		friend constexpr dual operator/(dual a, const dual &b)
+		{
+			return a /= b;
+		}
+
+		friend constexpr bool operator==(const dual &a, const dual &b)
+		{
+			return a.v == b.v;
+		}
+
+		friend constexpr auto operator<=>(const dual &a, const dual &b)
+		{
+			return a.v <=> b.v;
+		}
+	};
+
+	/// Value, first derivatives in two directions and the second derivative across them
+	template <typename num_t> using hyperdual = dual<dual<num_t>>;
+
+	/// The variable of a hyper-dual number at x, whose second derivative is f(x).derivative().derivative()
+	template <typename num_t> constexpr hyperdual<num_t> hyperdual_variable(const num_t &x)
+	{
+		return hyperdual<num_t>::variable(dual<num_t>::variable(x));
+	}
+
+	/// The precision of a dual is that of its value
+	template <typename num_t, std::size_t N> constexpr long double epsilon<dual<num_t, N>> = epsilon<num_t>;
+
+}; // namespace
+
+/// A dual has the limits of its value, which convert to it
+template <typename num_t, std::size_t N> struct std::numeric_limits<numeric::dual<num_t, N>> : std::numeric_limits<num_t>
+{ };
+
+namespace numeric
+{
+	// The derivatives of these are known, so they need not come out of the
+	// arithmetic of their evaluation. Each is the function of the value and
+	// its derivative at the value, put together by the chain rule.
+
+	/// The integer nearest x, which is flat between its steps so its derivatives are zero
+	template <typename num_t, std::size_t N> constexpr dual<num_t, N> nearbyint(const dual<num_t, N> &x)
+	{
+		return nearbyint(x.value());
+	}
+
+	template <typename num_t, std::size_t N> constexpr dual<num_t, N> exp(const dual<num_t, N> &x)
+	{
+		const num_t y = exp(x.value());
+		return x.chain(y, y);
+	}
+
+	template <typename num_t, std::size_t N> constexpr dual<num_t, N> expm1(const dual<num_t, N> &x)
+	{
+		const num_t y = expm1(x.value());
+		return x.chain(y, y + 1);
+	}
+
+	template <typename num_t, std::size_t N> constexpr dual<num_t, N> ln(const dual<num_t, N> &x)
+	{
+		return x.chain(ln(x.value()), 1/x.value());
+	}
+
+	template <typename num_t, std::size_t N> constexpr dual<num_t, N> log1p(const dual<num_t, N> &x)
+	{
+		return x.chain(log1p(x.value()), 1/(1 + x.value()));
+	}
+
+	template <typename num_t, std::size_t N> constexpr dual<num_t, N> sqrt(const dual<num_t, N> &x)
+	{
+		const num_t y = sqrt(x.value());
+		return x.chain(y, 1/(2*y));
+	}
+
+	/// The power of x raised to p, with the derivatives of both
+	template <typename num_t, std::size_t N> constexpr dual<num_t, N> pow(const dual<num_t, N> &x, const dual<num_t, N> &p)
+	{
+		const num_t &u = x.value(), &w = p.value();
+		const num_t y = pow(u, w);
+		// d(u^w) = w u^(w - 1) du + u^w ln(u) dw, where u^w ln(u) goes to 0 with u for w > 0
+		const num_t a = 0 == u ? w*pow(u, w - 1) : w*y/u;
+		const num_t b = 0 == y ? num_t(0) : y*ln(u);
+		std::array<num_t, N> g;
+		for (std::size_t i = 0; i < N; ++i) g[i] = a*x.derivative(i) + b*p.derivative(i);
+		return dual<num_t, N>(y, g);
+	}
+
+	template <typename num_t, std::size_t N> constexpr dual<num_t, N> sin(const dual<num_t, N> &x)
+	{
+		return x.chain(sin(x.value()), cos(x.value()));
+	}
+
+	template <typename num_t, std::size_t N> constexpr dual<num_t, N> cos(const dual<num_t, N> &x)
+	{
+		return x.chain(cos(x.value()), -sin(x.value()));
+	}
+
+	template <typename num_t, std::size_t N> constexpr dual<num_t, N> tanh(const dual<num_t, N> &x)
+	{
+		const num_t y = tanh(x.value());
+		return x.chain(y, 1 - y*y);
+	}
+
+	template <typename num_t, std::size_t N> constexpr dual<num_t, N> erf(const dual<num_t, N> &x)
+	{
+		const num_t &u = x.value();
+		return x.chain(erf(u), 2*num_t(rsqrtpi)*exp(-u*u));
+	}
+
+	template <typename num_t, std::size_t N> constexpr dual<num_t, N> erfc(const dual<num_t, N> &x)
+	{
+		const num_t &u = x.value();
+		return x.chain(erfc(u), -2*num_t(rsqrtpi)*exp(-u*u));
+	}
+
+	template <typename num_t, std::size_t N> constexpr dual<num_t, N> lgamma(const dual<num_t, N> &x)
+	{
+		return x.chain(lgamma(x.value()), digamma(x.value()));
+	}
+
+	template <typename num_t, std::size_t N> constexpr dual<num_t, N> tgamma(const dual<num_t, N> &x)
+	{
+		const num_t y = tgamma(x.value());
+		return x.chain(y, y*digamma(x.value()));
+	}
+
+	template <typename num_t, std::size_t N> constexpr dual<num_t, N> digamma(const dual<num_t, N> &x)
+	{
+		return x.chain(digamma(x.value()), trigamma(x.value()));
+	}
+
+}; // namespace
+
+#endif // file
@@ -0,0 +1,585 @@
+#ifndef expansion_hpp
+#define expansion_hpp
+
+/**
+ * Floating point expansions hold a number as the unevaluated sum of N doubles
+ * which do not overlap, each no more than half an ulp of the one before it.
+ * Two of them make a double_double of 106 bits and four a quad_double of 212
+ * bits, which is about 32 and 64 decimal digits, with the range of a double.
+ * All arithmetic is built on the error free transformations of Knuth's and
+ * Dekker's two-sum and of the two-product, which find the rounding error of
+ * one addition or multiplication as another double. The two-product is a
+ * single fused multiply-add on hardware that has one and Dekker's splitting
+ * otherwise, since a library fma in software would cost more than the split.
+ *
+ * Addition merges the components by magnitude and accumulates them from the
+ * top, so it keeps full precision through cancellation. The algorithms are
+ * those of Hida, Li and Bailey's QD library. This is hardly bignum speed; a
+ * double_double costs about ten to twenty doubles per operation and is still
+ * many times quicker than a software float of the same precision.
+ *
+ * The types are in the arithmetic namespace and, as there, the compound
+ * assignments are the primary operations. The binary operators are friends
+ * written on top of them so that a double or an integer converts on either
+ * side, which the templates of arithmetic.hpp would not allow. Everything is
+ * constexpr and the numeric functions that matter most are specialized for
+ * the precise policy: sqrt and ln by Newton's method from their value for the
+ * leading double, exp and the circular functions by their series after an
+ * exact reduction. The rest of numeric.hpp runs generically on top of those.
+ */
+
+#include "numeric.hpp"
+#include <array>
+#include <bit>
+#include <cmath>
+#include <compare>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+namespace arithmetic
+{
+	/// The sum a + b rounded, with e taking its rounding error exactly (Knuth)
+	constexpr double two_sum(double a, double b, double &e)
+	{
+		const double s = a + b;
+		const double v = s - a;
+		e = (a - (s - v)) + (b - v);
+		return s;
+	}
+
+	/// The sum a + b rounded, with e taking its rounding error exactly when |a| >= |b| (Dekker)
+	constexpr double quick_two_sum(double a, double b, double &e)
+	{
+		const double s = a + b;
+		e = b - (s - a);
+		return s;
+	}
+
+	/// The product a b rounded, with e taking its rounding error exactly
+	constexpr double two_prod(double a, double b, double &e)
+	{
+		const double p = a*b;
+		#ifdef FP_FAST_FMA
+		if (not std::is_constant_evaluated()) {
+			e = std::fma(a, b, -p);
+			return p;
+		}
+		#endif
+		// Dekker's split of each factor into halves of 26 bits whose products are exact
+		constexpr double split = 134217729.0; // 2^27 + 1
+		const double s = split*a, t = split*b;
+		const double ah = s - (s - a), al = a - ah;
+		const double bh = t - (t - b), bl = b - bh;
+		e = ((ah*bh - p) + ah*bl + al*bh) + al*bl;
+		return p;
+	}
+
+	/// The sum a + b + c accumulated into the pair (a, b), returning a leading double once it is complete
+	constexpr double quick_three_accum(double &a, double &b, double c)
+	{
+		double s = two_sum(b, c, b);
+		s = two_sum(a, s, a);
+		if (a != 0 and b != 0) return s;
+		if (b == 0) {
+		 b = a;
+		 a = s;
+		} else {
+		 a = s;
+		}
+		return 0;
+	}
+
+	/// Compresses the M overlapping doubles of c into N which do not overlap
+	template <std::size_t N, std::size_t M> constexpr std::array<double, N> renormalize(std::array<double, M> c)
+	{
+		std::array<double, N> r { };
+		if (numeric::isinf(c[0])) {
+		 r[0] = c[0];
+		 return r;
+		}
+		// Sweep up from the bottom so that each sum holds everything below it
+		for (std::size_t i = M - 1; i > 0; --i) c[i - 1] = quick_two_sum(c[i - 1], c[i], c[i]);
+		// Then down from the top, keeping an error only once it is not zero
+		std::size_t k = 0;
+		double s = c[0];
+		for (std::size_t i = 1; i < M; ++i) {
+		 if (k + 1 < N) {
+		  double e;
+		  s = quick_two_sum(s, c[i], e);
+		  if (e != 0) {
+		   r[k++] = s;
+		   s = e;
+		  }
+		 } else {
+		  s += c[i];
+		 }
+		}
+		r[k] = s;
+		return r;
+	}
+
+	/// A number held as the sum of N doubles which do not overlap, in decreasing magnitude
+	template <std::size_t N> class expansion
+	{
+		static_assert(N == 2 or N == 4, "expansions are of two or four doubles");
+
+		std::array<double, N> x { };
+
+	public:
+
+		constexpr expansion() = default;
+
+		/// Converts any arithmetic value, splitting a long double over two components
+		template <typename value_t> requires std::is_arithmetic_v<value_t>
+		constexpr expansion(value_t v)
+		{
+			if constexpr (std::is_integral_v<value_t>) {
+				*this = expansion(static_cast<long double>(v));
+			} else {
+				x[0] = static_cast<double>(v);
+				if (not numeric::isinf(x[0])) x[1] = static_cast<double>(v - x[0]);
+			}
+		}
+
+		/// Takes the given components, which should already not overlap
+		constexpr explicit expansion(const std::array<double, N> &c) : x(c)
+		{ }
+
+		/// The component of index i, the leading one being 0
+		constexpr double operator[](std::size_t i) const
+		{
+			return x[i];
+		}
+
+		constexpr explicit operator double() const
+		{
+			return x[0];
+		}
+
+		constexpr explicit operator long double() const
+		{
+			long double s = 0;
+			for (std::size_t i = N; i > 0; --i) s += x[i - 1];
+			return s;
+		}
+
+		constexpr expansion operator-() const
+		{
+			expansion r;
+			for (std::size_t i = 0; i < N; ++i) r.x[i] = -x[i];
+			return r;
+		}
+
+		constexpr expansion operator+() const
+		{
+			return *this;
+		}
+
+		constexpr expansion &operator+=(const expansion &b)
+		{
+			if constexpr (N == 2) {
+				double e, f;
+				double s = two_sum(x[0], b.x[0], e);
+				const double t = two_sum(x[1], b.x[1], f);
+				e += t;
+				s = quick_two_sum(s, e, e);
+				e += f;
+				x[0] = quick_two_sum(s, e, x[1]);
+			} else {
+				// Merge the components by magnitude into a double length accumulator
+				auto larger = [](double p, double q) { return numeric::fabs(p) > numeric::fabs(q); };
+				std::array<double, N> c { };
+				std::size_t i = 0, j = 0, k = 0;
+				double u = larger(x[i], b.x[j]) ? x[i++] : b.x[j++];
+				double v = larger(x[i], b.x[j]) ? x[i++] : b.x[j++];
+				u = quick_two_sum(u, v, v);
+				while (k < N) {
+				 if (N <= i and N <= j) {
+				  c[k] = u;
+				  if (k + 1 < N) c[++k] = v;
+				  break;
+				 }
+				 double t;
+				 if (N <= i) t = b.x[j++];
+				 else if (N <= j) t = x[i++];
+				 else t = larger(x[i], b.x[j]) ? x[i++] : b.x[j++];
+				 const double s = quick_three_accum(u, v, t);
+				 if (s != 0) c[k++] = s;
+				}
+				// What is left is below the precision
+				for (; i < N; ++i) c[N - 1] += x[i];
+				for (; j < N; ++j) c[N - 1] += b.x[j];
+				x = renormalize<N>(c);
+			}
+			return *this;
+		}
+
+		constexpr expansion &operator-=(const expansion &b)
+		{
+			return *this += -b;
+		}
+
+		constexpr expansion &operator*=(const expansion &b)
+		{
+			const auto &a = x;
+			if constexpr (N == 2) {
+				double e;
+				const double p = two_prod(a[0], b.x[0], e);
+				e += a[0]*b.x[1] + a[1]*b.x[0];
+				x[0] = quick_two_sum(p, e, x[1]);
+			} else {
+				// Products of the same order in the unit roundoff are summed together
+				double q0, q1, q2, q3, q4, q5, t0, t1;
+				double p0 = two_prod(a[0], b.x[0], q0);
+				double p1 = two_prod(a[0], b.x[1], q1);
+				double p2 = two_prod(a[1], b.x[0], q2);
+				double p3 = two_prod(a[0], b.x[2], q3);
+				double p4 = two_prod(a[1], b.x[1], q4);
+				double p5 = two_prod(a[2], b.x[0], q5);
+				three_sum(p1, p2, q0);
+				three_sum(p2, q1, q2);
+				three_sum(p3, p4, p5);
+				const double s0 = two_sum(p2, p3, t0);
+				double s1 = two_sum(q1, p4, t1);
+				double s2 = q2 + p5;
+				s1 = two_sum(s1, t0, t0);
+				s2 += t0 + t1;
+				// The third order needs no error terms
+				s1 += a[0]*b.x[3] + a[1]*b.x[2] + a[2]*b.x[1] + a[3]*b.x[0] + q0 + q3 + q4 + q5;
+				x = renormalize<N>(std::array<double, 5> { p0, p1, s0, s1, s2 });
+			}
+			return *this;
+		}
+
+		constexpr expansion &operator/=(const expansion &b)
+		{
+			// Long division, one double of the quotient at a time
+			std::array<double, N + 1> q;
+			expansion r = *this;
+			for (std::size_t i = 0; i <= N; ++i) {
+			 q[i] = r.x[0]/b.x[0];
+			 if (i < N) r -= b*q[i];
+			}
+			x = renormalize<N>(q);
+			return *this;
+		}
+
+		constexpr expansion &operator++()
+		{
+			return *this += 1;
+		}
+
+		constexpr expansion &operator--()
+		{
+			return *this -= 1;
+		}
+
+		constexpr expansion operator++(int)
+		{
+			const expansion r = *this;
+			*this += 1;
+			return r;
+		}
+
+		constexpr expansion operator--(int)
+		{
+			const expansion r = *this;
+			*this -= 1;
+			return r;
+		}
+
+		friend constexpr expansion operator+(expansion a, const expansion &b)
+		{
+			return a += b;
+		}
+
+		friend constexpr expansion operator-(expansion a, const expansion &b)
+		{
+			return a -= b;
+		}
+
+		friend constexpr expansion operator*(expansion a, const expansion &b)
+		{
+			return a *= b;
+		}
+
+		friend constexpr expansion operator/(expansion a, const expansion &b)
+		{
+			return a /= b;
+		}
+
+		/// Components are normalized, so equal numbers have equal components
+		friend constexpr bool operator==(const expansion &a, const expansion &b)
+		{
+			return a.x == b.x;
+		}
+
+		friend constexpr std::partial_ordering operator<=>(const expansion &a, const expansion &b)
+		{
+			for (std::size_t i = 0; i < N; ++i) {
+			 if (a.x[i] < b.x[i]) return std::partial_ordering::less;
+			 if (b.x[i] < a.x[i]) return std::partial_ordering::greater;
+			 if (a.x[i] != b.x[i]) return std::partial_ordering::unordered;
+			}
+			return std::partial_ordering::equivalent;
+		}
+
+		/// The number a 2^k, which is exact
+		friend constexpr expansion ldexp(expansion a, int k)
+		{
+			for (auto &c : a.x) c = numeric::ldexp(c, k);
+			return a;
+		}
+
+	private:
+
+		/// The sum a + b + c into the three of them, largest first
+		static constexpr void three_sum(double &a, double &b, double &c)
+		{
+			double t2, t3;
+			const double t1 = two_sum(a, b, t2);
+			a = two_sum(c, t1, t3);
+			b = two_sum(t2, t3, c);
+		}
+	};
+
+	/// About 32 decimal digits with the range of a double
+	using double_double = expansion<2>;
+
+	/// About 64 decimal digits with the range of a double
+	using quad_double = expansion<4>;
+
+}; // namespace
+
+template <std::size_t N> struct std::numeric_limits<arithmetic::expansion<N>>
+{
+	using expansion = arithmetic::expansion<N>;
+	using limits = std::numeric_limits<double>;
+
+	static constexpr bool is_specialized = true;
+	static constexpr bool is_signed = true;
+	static constexpr bool is_integer = false;
+	static constexpr bool is_exact = false;
+	static constexpr bool has_infinity = true;
+	static constexpr bool has_quiet_NaN = true;
+	static constexpr bool has_signaling_NaN = false;
+	static constexpr bool is_iec559 = false;
+	static constexpr bool is_bounded = true;
+	static constexpr bool is_modulo = false;
+	static constexpr int radix = 2;
+	static constexpr int digits = static_cast<int>(N)*limits::digits;
+	static constexpr int digits10 = static_cast<int>(N)*limits::digits10;
+	static constexpr int max_digits10 = digits10 + 2;
+	static constexpr int min_exponent = limits::min_exponent + digits - limits::digits;
+	static constexpr int min_exponent10 = limits::min_exponent10 + digits10 - limits::digits10;
+	static constexpr int max_exponent = limits::max_exponent;
+	static constexpr int max_exponent10 = limits::max_exponent10;
+	static constexpr std::float_round_style round_style = std::round_to_nearest;
+
+	/// The smallest number whose last component is still normal
+	static constexpr expansion min() noexcept { return numeric::ldexp(1.0, min_exponent - 1); }
+	static constexpr expansion max() noexcept { return limits::max(); }
+	static constexpr expansion lowest() noexcept { return -max(); }
+	/// One part in 2^52 for each component, allowing the last bits of the last to be wrong
+	static constexpr expansion epsilon() noexcept { return numeric::ldexp(1.0, -static_cast<int>(N)*(limits::digits - 1)); }
+	static constexpr expansion round_error() noexcept { return 0.5; }
+	static constexpr expansion infinity() noexcept { return limits::infinity(); }
+	static constexpr expansion quiet_NaN() noexcept { return limits::quiet_NaN(); }
+	static constexpr expansion denorm_min() noexcept { return limits::denorm_min(); }
+};
+
+namespace arithmetic
+{
+	/// Newton steps from a double to the full precision, each of which doubles the digits
+	template <std::size_t N> constexpr int newton_steps = std::bit_width(N) - 1;
+
+	/// The natural logarithm of 2 to the precision of the expansion
+	template <std::size_t N> constexpr auto expansion_ln2 = [] {
+		constexpr std::array<double, 4> c { 0x1.62e42fefa39efp-1, 0x1.abc9e3b39803fp-56, 0x1.7b57a079a1934p-111, -0x1.ace93a4ebe5d1p-165 };
+		std::array<double, N> r;
+		for (std::size_t i = 0; i < N; ++i) r[i] = c[i];
+		return expansion<N>(r);
+	}();
+
+	/// Half of pi to nine doubles, twice the components of a quad_double and one more, as the reduction of sincos needs
+	constexpr std::array<double, 9> pi_2_components {
+		0x1.921fb54442d18p+0, 0x1.1a62633145c07p-54, -0x1.f1976b7ed8fbcp-110, 0x1.4cf98e804177dp-164, 0x1.31d89cd9128a5p-218,
+		0x1.0f31c6809bbdfp-276, 0x1.519b3cd3a431bp-331, 0x1.8158536f92f8ap-386, 0x1.ba7f09ab6b6a9p-442
+	};
+
+	/// Half of pi to the precision of the expansion
+	template <std::size_t N> constexpr auto expansion_pi_2 = [] {
+		std::array<double, N> r;
+		for (std::size_t i = 0; i < N; ++i) r[i] = pi_2_components[i];
+		return expansion<N>(r);
+	}();
+
+	/// Inverses of the factorials to the precision of the expansion, enough for the series below
+	template <std::size_t N> constexpr auto expansion_inverse_fact = [] {
+		std::array<expansion<N>, 16*N> c;
+		c[0] = 1;
+		for (std::size_t n = 1; n < c.size(); ++n) c[n] = c[n - 1]/expansion<N>(n);
+		return c;
+	}();
+
+	/// The square root of a >= 0 by Newton's method on the inverse root, with Karp's last step
+	template <std::size_t N> constexpr expansion<N> sqrt(const expansion<N> &a)
+	{
+		if (a[0] <= 0) return a[0] < 0 ? std::numeric_limits<double>::quiet_NaN() : a;
+		if (numeric::isinf(a[0]) or numeric::isnan(a[0])) return a;
+		expansion<N> r = 1/(std::is_constant_evaluated() ? numeric::sqrt(a[0]) : std::sqrt(a[0]));
+		const expansion<N> h = ldexp(a, -1);
+		for (int n = 1; n < newton_steps<N>; ++n) r += (0.5 - h*r*r)*r;
+		const expansion<N> s = a*r;
+		return s + (a - s*s)*ldexp(r, -1);
+	}
+
+	/// Euler's number raised to the exponent a
+	template <std::size_t N> constexpr expansion<N> exp(const expansion<N> &a)
+	{
+		constexpr int halvings = 1 + 4*N;
+		constexpr double eps = std::numeric_limits<expansion<N>>::epsilon()[0];
+		if (numeric::isnan(a[0])) return a;
+		if (709.79 < a[0]) return std::numeric_limits<double>::infinity();
+		if (a[0] < -745.14) return 0;
+		// So a = m ln2 + r 2^halvings exactly, with |r| no more than ln2 2^(-halvings - 1)
+		const double m = numeric::nearbyint(a[0]/expansion_ln2<N>[0]);
+		const expansion<N> r = ldexp(a - expansion_ln2<N>*m, -halvings);
+		// The series of expm1, which keeps the digits of a small result
+		expansion<N> s = r, p = r;
+		for (std::size_t n = 2; n < expansion_inverse_fact<N>.size(); ++n) {
+		 p *= r;
+		 const expansion<N> t = p*expansion_inverse_fact<N>[n];
+		 s += t;
+		 if (numeric::fabs(t[0]) <= eps*numeric::fabs(s[0])) break;
+		}
+		// Square back up by expm1(2r) = expm1(r)(2 + expm1(r))
+		for (int n = 0; n < halvings; ++n) s *= 2 + s;
+		return ldexp(s + 1, static_cast<int>(m));
+	}
+
+	/// The natural logarithm of a by Newton's method on the exponential
+	template <std::size_t N> constexpr expansion<N> ln(const expansion<N> &a)
+	{
+		if (a[0] <= 0) return a[0] < 0 ? std::numeric_limits<double>::quiet_NaN() : -std::numeric_limits<double>::infinity();
+		if (numeric::isinf(a[0]) or numeric::isnan(a[0])) return a;
+		expansion<N> x = numeric::ln(a[0]);
+		for (int n = 0; n < newton_steps<N>; ++n) x += a*exp(-x) - 1;
+		return x;
+	}
+
+	/// The exact sum of the M doubles of t as M which do not overlap, in decreasing magnitude and then zeros (Shewchuk's growing expansion)
+	template <std::size_t M> constexpr std::array<double, M> exact_sum(const std::array<double, M> &t)
+	{
+		// Each term is carried up through the components so far, which keep the rounding errors in increasing magnitude
+		std::array<double, M> h { };
+		for (std::size_t i = 0; i < M; ++i) {
+		 double q = t[i];
+		 for (std::size_t k = 0; k < i; ++k) q = two_sum(q, h[k], h[k]);
+		 h[i] = q;
+		}
+		std::array<double, M> r { };
+		std::size_t n = 0;
+		for (std::size_t i = M; i > 0; --i) {
+		 if (h[i - 1] != 0) r[n++] = h[i - 1];
+		}
+		return r;
+	}
+
+	/// The sine and cosine of a, each by its series after reducing a by a multiple of pi/2
+	template <std::size_t N> constexpr std::array<expansion<N>, 2> sincos(const expansion<N> &a)
+	{
+		constexpr double eps = std::numeric_limits<expansion<N>>::epsilon()[0];
+		if (numeric::isnan(a[0]) or numeric::isinf(a[0])) return { std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::quiet_NaN() };
+		const double j = numeric::nearbyint(a[0]/pi_2_components[0]);
+		// The leading digits of a cancel against those of j pi/2, so pi/2 is taken to 2N + 1 doubles and a - j pi/2 summed exactly
+		constexpr std::size_t M = 2*N + 1;
+		std::array<double, N + 2*M> t;
+		for (std::size_t i = 0; i < N; ++i) t[i] = a[i];
+		for (std::size_t k = 0; k < M; ++k) {
+		 double e;
+		 t[N + 2*k] = -two_prod(j, pi_2_components[k], e);
+		 t[N + 2*k + 1] = -e;
+		}
+		const expansion<N> r(renormalize<N>(exact_sum(t)));
+		const expansion<N> rr = -(r*r);
+		expansion<N> s = r, c = 1, p = r, q = 1;
+		for (std::size_t n = 2; n + 1 < expansion_inverse_fact<N>.size(); n += 2) {
+		 q *= rr;
+		 p *= rr;
+		 const expansion<N> u = q*expansion_inverse_fact<N>[n];
+		 const expansion<N> v = p*expansion_inverse_fact<N>[n + 1];
+		 c += u;
+		 s += v;
+		 if (numeric::fabs(u[0]) <= eps and numeric::fabs(v[0]) <= eps*numeric::fabs(r[0])) break;
+		}
+		// Turn by the quarters that were taken off
+		switch ((static_cast<int>(j - 4*numeric::nearbyint(j/4)) + 4) % 4) {
+		case 1: return { c, -s };
+		case 2: return { -s, -c };
+		case 3: return { -c, s };
+		}
+		return { s, c };
+	}
+
+}; // namespace
+
+namespace numeric
+{
+	/// An expansion is not convertible to long double implicitly, so this is not derived from its epsilon
+	template <std::size_t N> constexpr long double epsilon<arithmetic::expansion<N>> = ldexp(1.0L, -static_cast<int>(N)*(std::numeric_limits<double>::digits - 1) - 1);
+
+	template <> constexpr arithmetic::double_double sqrt<arithmetic::double_double, precise>(arithmetic::double_double x)
+	{
+		return arithmetic::sqrt(x);
+	}
+
+	template <> constexpr arithmetic::quad_double sqrt<arithmetic::quad_double, precise>(arithmetic::quad_double x)
+	{
+		return arithmetic::sqrt(x);
+	}
+
+	template <> constexpr arithmetic::double_double exp<arithmetic::double_double, precise>(arithmetic::double_double x)
+	{
+		return arithmetic::exp(x);
+	}
+
+	template <> constexpr arithmetic::quad_double exp<arithmetic::quad_double, precise>(arithmetic::quad_double x)
+	{
+		return arithmetic::exp(x);
+	}
+
+	template <> constexpr arithmetic::double_double ln<arithmetic::double_double, precise>(arithmetic::double_double x)
+	{
+		return arithmetic::ln(x);
+	}
+
+	template <> constexpr arithmetic::quad_double ln<arithmetic::quad_double, precise>(arithmetic::quad_double x)
+	{
+		return arithmetic::ln(x);
+	}
+
+	template <> constexpr arithmetic::double_double sin<arithmetic::double_double, precise>(arithmetic::double_double x)
+	{
+		return arithmetic::sincos(x)[0];
+	}
+
+	template <> constexpr arithmetic::quad_double sin<arithmetic::quad_double, precise>(arithmetic::quad_double x)
+	{
+		return arithmetic::sincos(x)[0];
+	}
+
+	template <> constexpr arithmetic::double_double cos<arithmetic::double_double, precise>(arithmetic::double_double x)
+	{
+		return arithmetic::sincos(x)[1];
+	}
+
+	template <> constexpr arithmetic::quad_double cos<arithmetic::quad_double, precise>(arithmetic::quad_double x)
+	{
+		return arithmetic::sincos(x)[1];
+	}
+
+}; // namespace
+
+#endif // file
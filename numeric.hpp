@@ -33,46 +33,129 @@
 
 #include <algorithm>
 #include <utility>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <array>
+#include <span>
+#include <bit>
+#include <cassert>
 #include <cmath>
+#include <vector>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include "series.hpp"
+#include "prime.hpp"
+
+// Batch loops are cloned for these targets and picked by the loader at run time
+#if defined(__x86_64__) && defined(__linux__) && defined(__GNUC__)
+#define numeric_clones __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define numeric_clones
+#endif
+
+// Lane kernels and loops must be inlined into the clones to be vectorized there
+#if defined(__GNUC__)
+#define numeric_lane __attribute__((always_inline)) inline
+#else
+#define numeric_lane inline
+#endif
 
 namespace numeric
 {
 	// These are not always defined in cmath nor with 128 bit precision
-	constexpr auto e       = 2.718281828459045235360287471352662498L;
-	constexpr auto ln2     = 0.693147180559945309417232121458176568L;
-	constexpr auto ln10    = 2.302585092994045684017991454684364208L;
-	constexpr auto log2e   = 1.442695040888963407359924681001892137L;
-	constexpr auto log10e  = 0.434294481903251827651128918916605082L;
-	constexpr auto pi      = 3.141592653589793238462643383279502884L;
-	constexpr auto pi_2    = 1.570796326794896619231321691639751442L;
-	constexpr auto pi_4    = 0.785398163397448309615660845819875721L;
-	constexpr auto pi2_6   = 1.644934066848226436472415166646025189L;
-	constexpr auto sqrt2pi = 2.506628274631000502415765284811045253L;
-	constexpr auto sqrt2   = 1.414213562373095048801688724209698079L;
-	constexpr auto ngamma  = 0.577215664901532860606512090082402431L;
+	constexpr auto e         = 2.718281828459045235360287471352662498L;
+	constexpr auto ln2       = 0.693147180559945309417232121458176568L;
+	constexpr auto ln10      = 2.302585092994045684017991454684364208L;
+	constexpr auto log2e     = 1.442695040888963407359924681001892137L;
+	constexpr auto log10e    = 0.434294481903251827651128918916605082L;
+	constexpr auto pi        = 3.141592653589793238462643383279502884L;
+	constexpr auto pi_2      = 1.570796326794896619231321691639751442L;
+	constexpr auto pi_4      = 0.785398163397448309615660845819875721L;
+	constexpr auto pi2_6     = 1.644934066848226436472415166646025189L;
+	constexpr auto sqrt2pi   = 2.506628274631000502415765284811045253L;
+	constexpr auto rsqrtpi   = 0.564189583547756286948079451560772586L;
+	constexpr auto lnsqrt2pi = 0.918938533204672741780329736405617640L;
+	constexpr auto sqrt2     = 1.414213562373095048801688724209698079L;
+	constexpr auto ngamma    = 0.577215664901532860606512090082402431L;
 	
 	/// The greatest common divisor d so that m|d and n|d
-	template <typename uint_t> uint_t gcd(uint_t m, uint_t n)
+	template <typename uint_t> constexpr uint_t gcd(uint_t m, uint_t n)
 	{
-		if (n < m) std::swap(m, n);
-		while (m) {
-		 n %= m;
-		 std::swap(m, n);
+		if constexpr (std::is_integral_v<uint_t>) {
+			// Stein's binary method, which shifts and subtracts instead of dividing
+			using bits = std::make_unsigned_t<uint_t>;
+			bits u = m, v = n;
+			if constexpr (std::is_signed_v<uint_t>) {
+				if (m < 0) u = -u;
+				if (n < 0) v = -v;
+			}
+			if (0 == u) return static_cast<uint_t>(v);
+			if (0 == v) return static_cast<uint_t>(u);
+			const int k = std::countr_zero(static_cast<bits>(u | v));
+			u >>= std::countr_zero(u);
+			do {
+			 v >>= std::countr_zero(v);
+			 if (v < u) std::swap(u, v);
+			 v -= u;
+			}
+			while (v);
+			return static_cast<uint_t>(u << k);
+		} else {
+			if (n < m) std::swap(m, n);
+			while (m) {
+			 n %= m;
+			 std::swap(m, n);
+			}
+			return n;
 		}
-		return n;
 	}
 
 	/// The lowest common multiple, so that gcd(m, n)*lcm(m, n) = m*n
-	template <typename uint_t> uint_t lcm(uint_t m, uint_t n)
+	template <typename uint_t> constexpr uint_t lcm(uint_t m, uint_t n)
 	{
 		return m * (n / gcd(m, n));
 	}
 
+	/// Largest argument for which factorials and rows of Pascal's triangle are kept once computed
+	constexpr std::size_t combinatorial_cache = 1 << 12;
+
+	/// The factorial of n from a table shared between threads, which grows as needed
+	template <typename uint_t> uint_t cached_fact(uint_t n)
+	{
+		static std::shared_mutex mutex;
+		static std::vector<uint_t> table { 1 };
+		const auto k = std::min(static_cast<std::size_t>(n), combinatorial_cache);
+		uint_t m;
+		bool cached;
+		{
+			std::shared_lock lock(mutex);
+			cached = k < table.size();
+			if (cached) m = table[k];
+		}
+		if (not cached) {
+			std::unique_lock lock(mutex);
+			while (table.size() <= k) {
+			 table.push_back(table.back()*static_cast<uint_t>(table.size()));
+			}
+			m = table[k];
+		}
+		// Multiply on past the end of the table
+		while (static_cast<uint_t>(k) < n) {
+		 m *= n;
+		 --n;
+		}
+		return m;
+	}
+
 	/// The factorial of n, n! = n(n - 1)(n - 2)...(2)(1)
-	template <typename uint_t> uint_t fact(uint_t n)
+	template <typename uint_t> constexpr uint_t fact(uint_t n)
 	{
+		// No table is kept in a constant expression, where it is just the product
+		if (not std::is_constant_evaluated()) return cached_fact(n);
 		uint_t m = 1;
-		while (n) {
+		while (1 < n) {
 		 m *= n;
 		 --n;
 		}
@@ -80,7 +163,7 @@ namespace numeric
 	}
 
 	/// The semifactorial of k, (2k)!! = (2k)(2k - 2)(2k - 4)...(4)(2)
-	template <typename uint_t> uint_t facts(uint_t k)
+	template <typename uint_t> constexpr uint_t facts(uint_t k)
 	{
 		// (2k)!! = (k!)(2^k)
 		uint_t m = 1, n = 1;
@@ -93,20 +176,17 @@ namespace numeric
 	}
 
 	/// Determine whether two number are coprime
-	template <typename uint_t> bool coprime(uint_t m, uint_t n)
+	template <typename uint_t> constexpr bool coprime(uint_t m, uint_t n)
 	{
 		return 1 == gcd(m, n);
 	}
 
-	/// The primorial of n, n# = product of primes up to n + 1
+	/// The primorial of n, n# = product of primes up to n
 	template <typename uint_t> uint_t prim(uint_t n)
 	{
-		if (n < 2) return 1;
-		else ++n;
-		uint_t p = 2, q = 3;
-		while (q < n) {
-		 if (coprime(p, q)) p *= q;
-		 q += 2;
+		uint_t p = 1;
+		for (const auto q : primes(static_cast<std::uint64_t>(n) + 1)) {
+		 p *= static_cast<uint_t>(q);
 		}
 		return p;
 	}
@@ -114,23 +194,18 @@ namespace numeric
 	/// Alternate primorial, p(n)# = product of first n primes
 	template <typename uint_t> uint_t primo(uint_t n)
 	{
-		if (n < 1) return 1;
-		else --n;
-		uint_t p = 2, q = 3;
-		while (n) {
-		 if (coprime(p, q)) {
-		  p *= q;
-		  --n;
-		 }
-		 q += 2;
+		uint_t p = 1;
+		for (auto q = primes().begin(); n; ++q) {
+		 p *= static_cast<uint_t>(*q);
+		 --n;
 		}
 		return p;
 	}
 
-	/// The k permutations of n elements, n!/(n - k)!
-	template <typename uint_t> uint_t perm(uint_t n, uint_t k)
+	/// The k permutations of n elements, n!/(n - k)! = n(n - 1)...(n - k + 1)
+	template <typename uint_t> constexpr uint_t perm(uint_t n, uint_t k)
 	{
-		k = n - k;
+		if (n < k) return 0;
 		uint_t m = 1;
 		while (k) {
 		 m *= n;
@@ -140,393 +215,3062 @@ namespace numeric
 		return m;
 	}
 
-	/// The k combinations of n elements, n!/k!(n - k)!
-	template <typename uint_t> uint_t comb(uint_t n, uint_t k)
+	/// The k combinations of n elements by turns of multiplying and dividing, exact whenever the result fits
+	template <typename uint_t> constexpr uint_t binomial(uint_t n, uint_t k)
 	{
+		if (n < k) return 0;
 		k = std::min(k, n - k);
-		uint_t m = 1, r = 1;
-		while (k) {
-		 m *= n;
-		 --n;
-		 r *= k;
-		 --k;
+		uint_t m = 1;
+		for (uint_t i = 1; i <= k; ++i) {
+		 // Each m is C(n - k + i - 1, i - 1) and m(n - k + i)/i is whole, so
+		 // take what i has in common with m out of m, and the rest from n - k + i
+		 const uint_t g = gcd(m, i);
+		 m = m/g*((n - k + i)/(i/g));
 		}
-		return m/r;
+		return m;
 	}
 
-	/// Euler's number raised to the exponent x
-	template <typename num_t> num_t exp(num_t x)
+	/// Row n of Pascal's triangle, C(n, 0) to C(n, n), from a table shared between threads
+	template <typename uint_t> std::span<const uint_t> pascal(uint_t n)
 	{
-		uintmax_t n = 0;
-		num_t s = 0;
-		num_t t = 1;
-		do {
-		 s += t;
-		 t *= x;
-		 t /= ++n;
+		static std::shared_mutex mutex;
+		static std::unordered_map<std::size_t, std::vector<uint_t>> rows;
+		const auto k = static_cast<std::size_t>(n);
+		{
+			std::shared_lock lock(mutex);
+			const auto it = rows.find(k);
+			if (rows.end() != it) return it->second;
 		}
-		while (t);
-		return s;
+		std::vector<uint_t> r(k + 1);
+		r[0] = r[k] = 1;
+		for (std::size_t i = 1; i <= k/2; ++i) {
+		 const uint_t j = static_cast<uint_t>(i);
+		 const uint_t g = gcd(r[i - 1], j);
+		 r[i] = r[k - i] = r[i - 1]/g*((n - j + 1)/(j/g));
+		}
+		std::unique_lock lock(mutex);
+		// Nodes do not move as the map grows, so the row stays where it is
+		return rows.try_emplace(k, std::move(r)).first->second;
 	}
 
-	/// The number 2 raised to the exponent x
-	template <typename num_t> num_t exp2(num_t x)
+	/// The k combinations of n elements, n!/k!(n - k)!, from Pascal's triangle when n is small enough to keep rows
+	template <typename uint_t> constexpr uint_t comb(uint_t n, uint_t k)
 	{
-		return exp(x*ln2);
+		if (n < k) return 0;
+		if (std::is_constant_evaluated()) return binomial(n, k);
+		if (static_cast<std::size_t>(n) <= combinatorial_cache) return pascal(n)[static_cast<std::size_t>(k)];
+		return binomial(n, k);
 	}
 
-	/// The natural logarithm of x, so exp(ln(x)) = x
-	template <typename num_t> num_t ln(num_t x)
+	// Constant evaluation. The functions here are constexpr, so that tables
+	// of them can be made by the compiler, but the few functions of cmath
+	// that the reductions below rely on are not constexpr before C++23. So
+	// they go through these, which call the library at run time and in a
+	// constant expression do the same with plain arithmetic. They are only
+	// used on the binary types.
+
+	/// The power 2^k for k in the normal exponent range, by squaring, which is exact
+	template <typename num_t> constexpr num_t power_of_2(int k)
 	{
-		x = (x - 1)/(x + 1);
-		uintmax_t n = 1;
-		const num_t xx = x*x;
-		num_t r = x;
-		num_t s = 0;
-		num_t t = r;
-		do {
-		 s += t;
-		 r *= xx;
-		 n += 2;
-		 t = r/n;
+		num_t p = 1, b = k < 0 ? num_t(0.5) : num_t(2);
+		for (unsigned n = k < 0 ? -k : k; n; n >>= 1) {
+		 if (n & 1) p *= b;
+		 if (1 < n) b *= b;
 		}
-		while (t);
-		return 2*s;
+		return p;
 	}
 
-	/// The logarithm of x expressed in base b, so pow(b, log(x, b)) = x
-	template <typename num_t> num_t log(num_t x, num_t b)
+	/// Whether x is not a number
+	template <typename num_t> constexpr bool isnan(num_t x)
 	{
-		return ln(x)/ln(b);
+		if (std::is_constant_evaluated()) return x != x;
+		return std::isnan(x);
 	}
 
-	/// The logarithm of x expressed in base 2, so log2(x) = ln(x)/ln2
-	template <typename num_t> num_t log2(num_t x)
+	/// Whether x is infinite
+	template <typename num_t> constexpr bool isinf(num_t x)
 	{
-		return ln(x)/ln2;
+		if (std::is_constant_evaluated()) return std::numeric_limits<num_t>::max() < abs(x);
+		return std::isinf(x);
 	}
 
-	/// The logarithm of x expressed in base 10, so log10(x) = ln(x)/ln10
-	template <typename num_t> num_t log10(num_t x)
+	/// The magnitude of x
+	template <typename num_t> constexpr num_t fabs(num_t x)
 	{
-		return ln(x)/ln10;
-	}	
-	
-	/// The power of x raised to the exponent p
-	template <typename num_t> num_t pow(num_t x, num_t p)
+		if (std::is_constant_evaluated()) return x < 0 ? -x : 0 == x ? num_t(0) : x;
+		return std::fabs(x);
+	}
+
+	/// The magnitude of x with the sign of s, though a negative zero s counts as positive in a constant expression
+	template <typename num_t> constexpr num_t copysign(num_t x, num_t s)
 	{
-		return exp(ln(x)*p);
+		if (std::is_constant_evaluated()) return s < 0 ? -fabs(x) : fabs(x);
+		return std::copysign(x, s);
 	}
 
-	/// The square root of x for real x >= 0
-	template <typename num_t> num_t sqrt(num_t x)
+	/// The integer nearest x, ties to even
+	template <typename num_t> constexpr num_t nearbyint(num_t x)
 	{
-		return exp(ln(x)/2);
+		if (std::is_constant_evaluated()) {
+			// Adding and taking away 2^(p - 1) rounds off the fraction in the default rounding mode
+			constexpr num_t c = power_of_2<num_t>(std::numeric_limits<num_t>::digits - 1);
+			if (not (abs(x) < c)) return x;
+			return x < 0 ? (x - c) + c : (x + c) - c;
+		}
+		return std::nearbyint(x);
 	}
 
-	/// The cube root of x for real x
-	template <typename num_t> num_t cbrt(num_t x)
+	/// The product x 2^k
+	template <typename num_t> constexpr num_t ldexp(num_t x, int k)
 	{
-		return exp(ln(x)/3);
+		if (std::is_constant_evaluated()) {
+			// In two steps so neither power leaves the normal range
+			const int h = k/2;
+			return x*power_of_2<num_t>(h)*power_of_2<num_t>(k - h);
+		}
+		return std::ldexp(x, k);
 	}
-	
-	/// Extends factorials into the real numbers, tgamma(n) = (n - 1)!
-	template <typename num_t> num_t tgamma(num_t x)
+
+	/// Splits x = m 2^e with |m| in [1/2, 1), returning m and leaving e
+	template <typename num_t> constexpr num_t frexp(num_t x, int *e)
 	{
-		return std::tgamma(x);
+		if (std::is_constant_evaluated()) {
+			*e = 0;
+			if (0 == x or isnan(x) or isinf(x)) return x;
+			// Scaling by powers of 2 is exact, also for subnormals
+			constexpr num_t big = power_of_2<num_t>(32), small = power_of_2<num_t>(-32);
+			num_t m = fabs(x);
+			while (big <= m) {
+			 m *= small;
+			 *e += 32;
+			}
+			while (m < small) {
+			 m *= big;
+			 *e -= 32;
+			}
+			while (1 <= m) {
+			 m /= 2;
+			 ++*e;
+			}
+			while (m < num_t(0.5)) {
+			 m *= 2;
+			 --*e;
+			}
+			return x < 0 ? -m : m;
+		}
+		return std::frexp(x, e);
 	}
 
-	/// The natural logarithm of the gamma function
-	template <typename num_t> num_t lgamma(num_t x)
+	// Range reduction. For the binary floating point types we split off the
+	// exponent (frexp and ldexp) or a multiple of a constant (Cody-Waite) so
+	// that a fixed polynomial on a small interval does the rest of the work.
+	// The polynomials are truncated series whose length is worked out from
+	// the epsilon of each type, so every call has a fixed, small cost. Types
+	// without a binary exponent keep the plain series further below.
+
+	/// Types with a radix 2 exponent which frexp and ldexp can split off
+	template <typename num_t> constexpr bool is_binary = std::is_floating_point_v<num_t>;
+
+	/// Binary types with no more precision than double, for which approximations fitted to double will do
+	template <typename num_t> constexpr bool fits_double = [] {
+		if constexpr (is_binary<num_t>) return std::numeric_limits<num_t>::digits <= std::numeric_limits<double>::digits;
+		else return false;
+	}();
+
+	/// Inverse of the factorial, 1/n!
+	constexpr long double inverse_fact(unsigned n)
 	{
-		return std::lgamma(x);
+		long double t = 1;
+		while (n) {
+		 t /= n;
+		 --n;
+		}
+		return t;
 	}
 
-	/// The lower incomplete gamma function
-	template <typename num_t> num_t igamma(num_t a, num_t x)
+	/// Number of coefficients a(n) to keep before a(n) x^n falls below tol
+	template <typename coefficient> constexpr unsigned terms(coefficient a, long double x, long double tol)
 	{
-		num_t s = 0;
-		num_t t = pow(x, a)/a;
-		do {
-		 s += t;
+		unsigned n = 0;
+		long double t = 1;
+		while (tol < (a(n) < 0 ? -a(n) : a(n))*t) {
 		 t *= x;
-		 t /= ++a;
+		 ++n;
 		}
-		while (t);
-		s /= exp(x);
-		return s;
+		return n + 1;
 	}
 
-	/// The upper incomplete gamma function (lower's complement)
-	template <typename num_t> num_t igammac(num_t a, num_t x)
+	/// Tabulates the first N coefficients a(n) in the precision of num_t
+	template <typename num_t, unsigned N, typename coefficient> constexpr std::array<num_t, N> table(coefficient a)
 	{
-		return tgamma(a) - igamma(a, x);
+		std::array<num_t, N> c { };
+		for (unsigned n = 0; n < N; ++n) {
+		 c[n] = num_t(a(n));
+		}
+		return c;
 	}
-	
-	/// Extends combinations into the field of real numbers
-	template <typename num_t> num_t beta(num_t a, num_t b)
+
+	/// Rounds a table of coefficients to the precision of num_t
+	template <typename num_t, std::size_t N> constexpr std::array<num_t, N> narrow(const std::array<long double, N> &c)
 	{
-		return tgamma(a)*tgamma(b)/tgamma(a + b);
+		return table<num_t, N>([&](unsigned n) { return c[n]; });
 	}
-	
-	/// The lower incomplete beta function
-	template <typename num_t> num_t ibeta(num_t a, num_t b, num_t x)
+
+	/// Tabulates f at N points evenly spaced from lo to hi, which the compiler does when the table is constexpr
+	template <auto f, std::size_t N, typename num_t> constexpr std::array<num_t, N> make_table(num_t lo, num_t hi)
 	{
-		num_t n = 1;
-		num_t u = 1 - b;
-		num_t s = 0;
-		num_t t = pow(x, a);
-		do {
-		 s += t/a;
-		 ++a;
-		 t *= u;
-		 ++u;
-		 t /= n;
-		 ++n;
-		 t *= x;
+		std::array<num_t, N> y { };
+		for (std::size_t n = 0; n < N; ++n) {
+		 // Weighing both ends so that the last point is hi exactly
+		 const num_t t = 1 < N ? num_t(n)/num_t(N - 1) : num_t(0);
+		 y[n] = f((1 - t)*lo + t*hi);
 		}
-		while (t);
+		return y;
+	}
+
+	/// Horner's steps from the leading coefficient down, unrolled as a fold over n
+	template <typename num_t, std::size_t N, std::size_t... n>
+	constexpr numeric_lane num_t horner(const std::array<num_t, N> &c, num_t x, std::index_sequence<n...>)
+	{
+		num_t s = c[N - 1];
+		((s = s*x + c[N - 2 - n]), ...);
 		return s;
 	}
 
-	/// The upper incomplete beta function (lower's complement)
-	template <typename num_t> num_t ibetac(num_t a, num_t b, num_t x)
+	/// Evaluates the polynomial with coefficients c (lowest order first) at x
+	template <typename num_t, std::size_t N> constexpr numeric_lane num_t horner(const std::array<num_t, N> &c, num_t x)
 	{
-		return beta(a, b) - ibeta(a, b, x);
+		// Unrolled whatever N is, and not in a lambda, which need not be inlined, so that lane kernels have no call or loop inside
+		return horner(c, x, std::make_index_sequence<N - 1>());
 	}
 
-	/// The Dirichlet eta function for real x > 0
-	template <typename num_t> num_t eta(num_t x, num_t eps=1e-9)
+	// Accuracy policies. The kernels are truncated where their terms fall
+	// below the epsilon of the type, which is the precise policy and the
+	// default for every function. Much work (Monte Carlo, features for a
+	// model) has no use for more than a few digits, and under fast<tol> the
+	// same series stop where their terms fall below tol instead, so at 1e-4
+	// the kernels of double have about a third of their terms. A policy is
+	// the last template argument, exp<double, fast<1e-4>>(x), or the only
+	// one for the batch forms. Tolerances under epsilon are taken as it.
+
+	/// Accuracy policy of the full precision of each type
+	struct precise
 	{
-		bool a = false;
-		uintmax_t n = 1;
-		num_t s = 0;
-		num_t t = 1;
-		do {
-		 a = !a;
-		 a ? s += t : s -= t;
-		 t = pow<num_t>(++n, -x);
+		static constexpr long double tolerance = 0;
+	};
+
+	/// Accuracy policy of about tol relative error, traded for shorter kernels
+	template <double tol> struct fast
+	{
+		static constexpr long double tolerance = tol;
+	};
+
+	/// The relative tolerance to which the kernels of num_t are truncated under a policy
+	template <typename num_t, typename policy> constexpr long double tolerance = std::max<long double>(policy::tolerance, epsilon<num_t>);
+
+	/// A constant a + b + c split into hi + lo where n*hi is exact for integers n < 2^bits
+	template <typename num_t> struct cody_waite
+	{
+		num_t hi, lo;
+
+		constexpr cody_waite(double a, double b, double c, int bits)
+		: hi(veltkamp(num_t(a), bits)), lo(num_t((a - (long double) hi) + b + c))
+		{ }
+
+		/// Rounds x to fewer significant bits by Veltkamp's splitting
+		static constexpr num_t veltkamp(num_t x, int bits)
+		{
+			num_t f = 1;
+			while (bits) {
+			 f *= 2;
+			 --bits;
+			}
+			const num_t y = x*(f + 1);
+			return y - (y - x);
 		}
-		while (eps < t);
-		return s;
+	};
+
+	/// Bits needed to hold any binary exponent of num_t, including subnormals
+	template <typename num_t> constexpr int exponent_bits()
+	{
+		using limits = std::numeric_limits<num_t>;
+		int n = 0;
+		for (auto m = limits::max_exponent - limits::min_exponent + limits::digits; m; m >>= 1) ++n;
+		return n;
 	}
 
-	/// The Reimann zeta function for real x > 1, defined as a discrete sum
-	template <typename num_t> num_t zeta(num_t x, num_t eps=1e-9)
+	/// The natural logarithm of 2 split for Cody-Waite reduction
+	template <typename num_t> constexpr cody_waite<num_t> ln2_cw
 	{
-		uintmax_t n = 1;
-		num_t s = 0;
-		num_t t = 1;
-		do {
-		 s += t;
-		 t = pow<num_t>(++n, -x);
-		}
-		while (eps < t);
-		return s;
+		0x1.62e42fefa39efp-1, 0x1.abc9e3b39803fp-56, 0x1.7b57a079a1934p-111, exponent_bits<num_t>()
+	};
+
+	/// Coefficients of expm1(r)/r = 1 + r/2! + r^2/3! + ... for |r| <= ln2/2
+	constexpr long double expm1_term(unsigned n)
+	{
+		return inverse_fact(n + 1);
 	}
 
-	/// The Reimann zeta function for real x > 1, using Euler's product
-	template <typename num_t> num_t zeta_p(num_t x, num_t eps=1e-9)
+	template <typename num_t, typename policy = precise> constexpr unsigned expm1_terms = terms(expm1_term, ln2/2, tolerance<num_t, policy>);
+	template <typename num_t, typename policy = precise> constexpr auto expm1_table = table<num_t, expm1_terms<num_t, policy>>(expm1_term);
+
+	/// Kernel of exp(r) - 1 on the reduced range |r| <= ln2/2
+	template <typename num_t, typename policy = precise> constexpr numeric_lane num_t expm1_kernel(num_t r)
 	{
-		uintmax_t p = 2, q = 3;
-		num_t t = pow<num_t>(p, -x);
-		num_t s = 1 - t;
-		do {
-		 if (coprime(p, q)) {
-		  t = pow<num_t>(q, -x);
-		  s *= 1 - t;
-		  p *= q;
-		 }
-		 q += 2;
-		}
-		while (eps < t);
-		return 1/s;
+		return r*horner(expm1_table<num_t, policy>, r);
 	}
 
-	/// The Reimann zeta function for real x > 1, Dirichlet's eta identity
-	template <typename num_t> num_t zeta_e(num_t x, num_t eps=1e-9)
+	/// Coefficients of (atanh(s)/s - 1)/s^2 = 1/3 + s^2/5 + s^4/7 + ... in powers of s^2
+	constexpr long double atanh_term(unsigned n)
 	{
-		// Better convergence with eta identity
-		return eta(x, eps)/(1 - exp2(1 - x));
+		return 1.0L/(2*n + 3);
+	}
+
+	// With m in [sqrt(1/2), sqrt(2)) we have |s| = |(m - 1)/(m + 1)| < 3 - 2 sqrt(2)
+	constexpr auto ln_radius = (3 - 2*sqrt2)*(3 - 2*sqrt2);
+	template <typename num_t, typename policy = precise> constexpr unsigned ln_terms = terms(atanh_term, ln_radius, tolerance<num_t, policy>);
+	template <typename num_t, typename policy = precise> constexpr auto ln_table = table<num_t, ln_terms<num_t, policy>>(atanh_term);
+
+	/// Kernel of ln(m) = 2 atanh((m - 1)/(m + 1)) for m in [sqrt(1/2), sqrt(2))
+	template <typename num_t, typename policy = precise> constexpr numeric_lane num_t ln_kernel(num_t m)
+	{
+		const num_t s = (m - 1)/(m + 1);
+		const num_t ss = s*s;
+		return 2*s + 2*s*ss*horner(ln_table<num_t, policy>, ss);
 	}
 
-	/// The Gaussian hypergeometric function
-	template <typename num_t> num_t hyper(num_t a, num_t b, num_t c, num_t x)
+	/// Reduces x = k ln2 + r with |r| <= ln2/2, returning r and leaving k
+	template <typename num_t> constexpr num_t reduce_ln2(num_t x, int &k)
 	{
-		uintmax_t n = 1;
-		num_t s = 1;
-		num_t t = x*a*b/c;
-		do {
-		 s += t;
-		 t *= ++a;
-		 t /= ++c;
-		 t *= ++b;
-		 t /= ++n;
-		 t *= x;
+		using limits = std::numeric_limits<num_t>;
+		constexpr num_t top = (limits::max_exponent + 1)*ln2;
+		constexpr num_t bottom = (limits::min_exponent - limits::digits - 2)*ln2;
+		x = std::clamp(x, bottom, top);
+		const num_t n = nearbyint(x*num_t(log2e));
+		k = static_cast<int>(n);
+		return (x - n*ln2_cw<num_t>.hi) - n*ln2_cw<num_t>.lo;
+	}
+
+	/// Reduces x = 2^k m with m in [sqrt(1/2), sqrt(2)), returning m and leaving k
+	template <typename num_t> constexpr num_t reduce_frexp(num_t x, int &k)
+	{
+		num_t m = frexp(x, &k);
+		if (m < num_t(sqrt2/2)) {
+		 m *= 2;
+		 --k;
 		}
-		while (t);
+		return m;
+	}
+
+	/// The sum a + b = hi + lo exactly by Knuth's method, returning hi and leaving lo
+	template <typename num_t> constexpr num_t two_sum(num_t a, num_t b, num_t &lo)
+	{
+		const num_t s = a + b;
+		const num_t c = s - a;
+		lo = (a - (s - c)) + (b - c);
 		return s;
 	}
 
-	/// Kummer's confluent hypergeometric function
-	template <typename num_t> num_t kummer(num_t a, num_t c, num_t x)
+	// The exact sums and products below come apart if a multiply-add is fused
+	// into them, so contraction is turned off for them whatever the flags.
+
+#if defined(__clang__)
+#pragma clang fp contract(off)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC optimize("fp-contract=off")
+#endif
+
+	/// The leading half of the digits of x by Veltkamp's splitting, so that products of the halves of two numbers are exact
+	template <typename num_t> constexpr num_t split_half(num_t x)
+	{
+		constexpr num_t c = power_of_2<num_t>(std::numeric_limits<num_t>::digits - std::numeric_limits<num_t>::digits/2) + 1;
+		const num_t y = x*c;
+		return y - (y - x);
+	}
+
+	/// The product a b = hi + lo exactly by Dekker's method, returning hi and leaving lo
+	template <typename num_t> constexpr num_t two_product(num_t a, num_t b, num_t &lo)
 	{
-		uintmax_t n = 1;
-		num_t s = 1;
-		num_t t = x*a/c;
-		do {
-		 s += t;
-		 t *= ++a;
-		 t /= ++c;
-		 t *= x;
-		 t /= ++n;
+		const num_t p = a*b;
+		const num_t ah = split_half(a), al = a - ah;
+		const num_t bh = split_half(b), bl = b - bh;
+		lo = ((ah*bh - p) + ah*bl + al*bh) + al*bl;
+		return p;
+	}
+
+#if defined(__clang__)
+#pragma clang fp contract(on)
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+	/// Euler's number raised to the exponent x
+	template <typename num_t, typename policy = precise> constexpr num_t exp(num_t x)
+	{
+		if constexpr (is_binary<num_t>) {
+			if (isnan(x)) return x;
+			int k;
+			const num_t r = reduce_ln2(x, k);
+			return ldexp(1 + expm1_kernel<num_t, policy>(r), k);
+		} else {
+			uintmax_t n = 0;
+			num_t t = 1;
+			return sum<num_t>([&] {
+			 const num_t u = t;
+			 t *= x;
+			 t /= ++n;
+			 return u;
+			}, num_t(tolerance<num_t, policy>));
 		}
-		while (t);
-		return s;
 	}
 
-	/// Measures the complement of the error function (the tails)
-	template <typename num_t> num_t erfc(num_t x)
+	/// Euler's number raised to the exponent x, less one, without cancellation for small x
+	template <typename num_t, typename policy = precise> constexpr num_t expm1(num_t x)
 	{
-		constexpr auto isqrtpi = sqrt2/sqrt2pi;
-		return igammac<num_t>(0.5, x*x)*isqrtpi;
+		if constexpr (is_binary<num_t>) {
+			if (isnan(x)) return x;
+			int k;
+			const num_t r = reduce_ln2(x, k);
+			const num_t p = expm1_kernel<num_t, policy>(r);
+			if (0 == k) return p;
+			if (std::numeric_limits<num_t>::digits < k) return ldexp(1 + p, k) - 1;
+			const num_t f = ldexp(num_t(1), k);
+			return f*p + (f - 1);
+		} else {
+			return exp<num_t, policy>(x) - 1;
+		}
 	}
 
-	/// Measures the area under the bell curve for errors of size x
-	template <typename num_t> num_t erf(num_t x)
+	/// The number 2 raised to the exponent x
+	template <typename num_t> constexpr num_t exp2(num_t x)
 	{
-		return 1.0 - erfc(x);
+		if constexpr (is_binary<num_t>) {
+			if (isnan(x)) return x;
+			using limits = std::numeric_limits<num_t>;
+			x = std::clamp<num_t>(x, limits::min_exponent - limits::digits - 2, limits::max_exponent + 1);
+			const num_t n = nearbyint(x);
+			return ldexp(1 + expm1_kernel((x - n)*num_t(ln2)), static_cast<int>(n));
+		} else {
+			return exp(x*ln2);
+		}
 	}
 
-	/// In a right triangle, the leg opposite an angle over the hypotenuse
-	template <typename num_t> num_t sin(num_t x)
+	/// The natural logarithm of x, so exp(ln(x)) = x
+	template <typename num_t, typename policy = precise> constexpr num_t ln(num_t x)
 	{
-		uintmax_t n = 1;
-		const num_t xx = -x*x;
-		num_t s = 0;
-		num_t t = x;
-		do {
-		 s += t;
-		 t *= xx;
-		 t /= ++n;
-		 t /= ++n;
+		if constexpr (is_binary<num_t>) {
+			if (x < 0) return std::numeric_limits<num_t>::quiet_NaN();
+			if (0 == x) return -std::numeric_limits<num_t>::infinity();
+			if (isnan(x) or isinf(x)) return x;
+			int k;
+			const num_t m = reduce_frexp(x, k);
+			return k*ln2_cw<num_t>.hi + (ln_kernel<num_t, policy>(m) + k*ln2_cw<num_t>.lo);
+		} else {
+			x = (x - 1)/(x + 1);
+			uintmax_t n = 1;
+			const num_t xx = x*x;
+			num_t r = x;
+			return 2*sum<num_t>([&] {
+			 const num_t t = r/n;
+			 r *= xx;
+			 n += 2;
+			 return t;
+			}, num_t(tolerance<num_t, policy>));
 		}
-		while (t);
-		return s;
 	}
 
-	/// In a right triangle, the leg adjacent an angle over the hypotenuse
-	template <typename num_t> num_t cos(num_t x)
+	/// The natural logarithm of 1 + x, without cancellation for small x
+	template <typename num_t> constexpr num_t log1p(num_t x)
 	{
-		uintmax_t n = 0;
-		const num_t xx = -x*x;
-		num_t s = 0;
-		num_t t = 1;
-		do {
-		 s += t;
-		 t *= xx;
-		 t /= ++n;
-		 t /= ++n;
+		if constexpr (is_binary<num_t>) {
+			// Where the correction would be inf/inf
+			if (isinf(x) and 0 < x) return x;
 		}
-		while (t);
-		return s;
+		const num_t u = 1 + x;
+		if (1 == u) return x;
+		// Goldberg: the rounding error in u cancels in x/(u - 1)
+		return ln(u)*(x/(u - 1));
 	}
 
-	/// Slope of tangent line on a circle at angle x from the origin
-	template <typename num_t> num_t tan(num_t x)
+	/// Coefficients of (atanh(s)/s - 1)/s^2 for log1pmx, where |s| < 1/3
+	template <typename num_t> constexpr auto log1pmx_table = table<num_t, terms(atanh_term, 1/9.0L, epsilon<num_t>)>(atanh_term);
+
+	/// The natural logarithm of 1 + x less x, without cancellation for small x
+	template <typename num_t> constexpr num_t log1pmx(num_t x)
 	{
-		return sin(x)/cos(x);
+		if (x <= num_t(-0.5) or 1 <= x) return log1p(x) - x;
+		// With s = x/(2 + x), ln(1 + x) = 2 atanh(s) = 2s + 2s^3/3 + ..., in which 2s is x less s x
+		const num_t s = x/(2 + x), ss = s*s;
+		return 2*s*ss*horner(log1pmx_table<num_t>, ss) - s*x;
 	}
 
-	/// Arcsine returns the angle of a given sine
-	template <typename num_t> num_t asin(num_t x)
+	/// The scaled s log1pmx(d/s) for d = z - s, in which 1 + d/s would round off z/s once z is well below s
+	template <typename num_t> constexpr num_t log1pmx(num_t s, num_t z, num_t d)
 	{
-		const num_t a = 0.5, b = 0.5, c = 1.5;
-		return x*hyper(a, b, c, x*x);
+		const num_t t = d/s;
+		if (t < num_t(-0.5)) return s*(ln(z/s) - t);
+		return s*log1pmx(t);
 	}
 
-	/// Arccosine returns the angle of a given cosine
-	template <typename num_t> num_t acos(num_t x)
+	/// The kernel of ln past its leading 1/3, to a few more bits than epsilon, for ln_extended
+	template <typename num_t> constexpr auto ln_extended_table = table<num_t, terms(atanh_term, ln_radius, epsilon<num_t>) + 1>([](unsigned n) { return atanh_term(n + 1); });
+
+	/// One third as hi + lo, for ln_extended
+	template <typename num_t> constexpr num_t third_hi = num_t(1)/3;
+	template <typename num_t> constexpr num_t third_lo = []
 	{
-		return pi_2 - asin(x);
+		num_t r;
+		const num_t p = two_product(third_hi<num_t>, num_t(3), r);
+		return ((1 - p) - r)/3;
+	}();
+
+	/// The natural logarithm of a binary x > 0 to about twice the precision, hi + lo, returning hi and leaving lo
+	template <typename num_t> constexpr num_t ln_extended(num_t x, num_t &lo)
+	{
+		int k;
+		const num_t m = reduce_frexp(x, k);
+		// s = (m - 1)/(m + 1), with m - 1 exact, and with what m + 1 and the quotient round off kept in sl
+		num_t vl, pl;
+		const num_t u = m - 1;
+		const num_t v = two_sum(m, num_t(1), vl);
+		const num_t s = u/v;
+		const num_t p = two_product(s, v, pl);
+		const num_t sl = (((u - p) - pl) - s*vl)/v;
+		// 2 atanh(s + sl) is 2s + 2s^3/3 + 2s^5/5 + ... and 2 sl/(1 - s^2), where the cube term is too
+		// large to round once, so s^3 and 1/3 are carried as pairs and only the rest of the series rounds
+		num_t ssl, cl, dl, hl, gl;
+		const num_t ss = two_product(s, s, ssl);
+		const num_t c = two_product(s, ss, cl);
+		const num_t d = two_product(2*c, third_hi<num_t>, dl);
+		cl += s*ssl;
+		const num_t t = 2*(c*(third_lo<num_t> + ss*horner(ln_extended_table<num_t>, ss)) + cl*third_hi<num_t>) + 2*dl + 2*sl*(1 + ss) + k*ln2_cw<num_t>.lo;
+		const num_t h = two_sum(k*ln2_cw<num_t>.hi, 2*s, hl);
+		const num_t g = two_sum(h, d, gl);
+		lo = (hl + gl) + t;
+		return g;
 	}
 
-	/// Arctangent returns the angle of a given tangent
-	template <typename num_t> num_t atan(num_t x)
+	/// The logarithm of x expressed in base b, so pow(b, log(x, b)) = x
+	template <typename num_t> constexpr num_t log(num_t x, num_t b)
 	{
-		const num_t a = 0.5, b = 1.0, c = 1.5;
-		return x*hyper(a, b, c, -x*x);
+		return ln(x)/ln(b);
 	}
 
-	/// Deduces the quadrant correct angle of a given sine and cosine
-	template <typename num_t> num_t atan2(num_t y, num_t x)
+	/// The logarithm of x expressed in base 2, so log2(x) = ln(x)/ln2
+	template <typename num_t> constexpr num_t log2(num_t x)
 	{
-		if (x > 0) return atan(y/x);
-		if (x < 0) return atan(y/x) + (y < 0 ? -pi : +pi);
-		if (y > 0) return +pi_2;
-		if (y < 0) return -pi_2;
-		return NAN;
+		return ln(x)/ln2;
 	}
 
-	/// Rise of the point on an equilateral hyperbola at half of angle x
-	template <typename num_t> num_t sinh(num_t x)
+	/// The logarithm of x expressed in base 10, so log10(x) = ln(x)/ln10
+	template <typename num_t> constexpr num_t log10(num_t x)
 	{
-		uintmax_t n = 1;
-		const num_t xx = x*x;
-		num_t s = 0;
-		num_t t = x;
-		do {
-		 s += t;
-		 t *= xx;
-		 t /= ++n;
-		 t /= ++n;
+		return ln(x)/ln10;
+	}	
+	
+	/// The power of x raised to the exponent p
+	template <typename num_t> constexpr num_t pow(num_t x, num_t p)
+	{
+		return exp(ln(x)*p);
+	}
+
+	/// The square root of x for real x >= 0
+	template <typename num_t, typename policy = precise> constexpr num_t sqrt(num_t x)
+	{
+		// The hardware root is correctly rounded, and vectorizes
+		if constexpr (is_binary<num_t>) {
+			if (not std::is_constant_evaluated()) return std::sqrt(x);
 		}
-		while (t);
-		return s;
+		return exp<num_t, policy>(ln<num_t, policy>(x)/2);
 	}
 
-	/// Run of the point on equilateral hyperbola at half of angle x
-	template <typename num_t> num_t cosh(num_t x)
+	/// The cube root of x for real x
+	template <typename num_t> constexpr num_t cbrt(num_t x)
 	{
-		uintmax_t n = 0;
-		const num_t xx = x*x;
-		num_t s = 0;
-		num_t t = 1;
-		do {
-		 s += t;
-		 t *= xx;
-		 t /= ++n;
-		 t /= ++n;
+		return exp(ln(x)/3);
+	}
+	
+	// The gamma function. From 8 upwards the logarithm is Lanczos' series
+	// with g = 7 for float and double, good to about 1e-15, and for other
+	// types Stirling's series, once the argument has been shifted up to 16
+	// where that converges quickly. Both have an absolute error, which is
+	// too much near the roots of lgamma at 1 and 2, so below 8 we move down
+	// into [0.5, 2.5) and take the Taylor series about 2 instead, whose
+	// coefficients are the values of zeta at the integers. Below -0.5 we
+	// reflect with -x, tgamma(x) tgamma(-x) = -pi/(x sin(pi x)), except
+	// that lgamma is taken relative to its roots by the poles, where the
+	// reflection cancels. For binary types tgamma from 16 upwards is
+	// Stirling's series unshifted, with (x - 1/2) ln(x) - x carried to
+	// twice the precision so that exp does not magnify its rounding.
+
+	/// Lanczos' g and his coefficients for it, in the form c0 + c1/x + c2/(x + 1) + ...
+	constexpr long double lanczos_g = 7;
+	constexpr std::array<long double, 9> lanczos = {
+		0.99999999999980993227684700473478L, 676.520368121885098567009190444019L,
+		-1259.13921672240287047156078755283L, 771.3234287776530788486528258894L,
+		-176.61502916214059906584551354L, 12.507343278686904814458936853L,
+		-0.13857109526572011689554707L, 9.984369578019570859563e-6L,
+		1.50563273514931155834e-7L
+	};
+
+	template <typename num_t> constexpr auto lanczos_table = table<num_t, lanczos.size()>([](unsigned k) { return lanczos[k]; });
+
+	/// The sum in Lanczos' approximation for x >= 0.5
+	template <typename num_t> constexpr numeric_lane num_t lanczos_sum(num_t x)
+	{
+		return [&]<std::size_t... k>(std::index_sequence<k...>) {
+			return (lanczos_table<num_t>[0] + ... + (lanczos_table<num_t>[k + 1]/(x + num_t(k))));
+		}(std::make_index_sequence<lanczos.size() - 1>());
+	}
+
+	/// Weight (d(n) - d(k))/d(n) of the k-th term in Borwein's series of n terms, with its alternating sign
+	constexpr long double borwein_weight(unsigned n, unsigned k)
+	{
+		// d(k) sums u(i) for i <= k, with u(0) = 1 and u(i + 1) = u(i) 4(n + i)(n - i)/((2i + 1)(2i + 2))
+		long double u = 1, d = 0, e = 0;
+		for (unsigned i = 0; i <= n; ++i) {
+		 d += u;
+		 if (k < i) e += u;
+		 u *= 4.0L*(n + i)*(n - i)/((2*i + 1)*(2*i + 2.0L));
 		}
-		while (t);
-		return s;
+		return k & 1 ? -e/d : e/d;
 	}
 
-	/// Slope of a line meeting a hyperbola at half of angle x from origin
-	template <typename num_t> num_t tanh(num_t x)
+	/// The natural logarithm of a positive integer, worked out at compile time
+	constexpr long double ln_int(unsigned m)
+	{
+		// Halve into [1, 2) and then sum the series of 2 atanh((y - 1)/(y + 1))
+		long double y = m, k = 0;
+		while (2 <= y) {
+		 y /= 2;
+		 ++k;
+		}
+		const long double z = (y - 1)/(y + 1), zz = z*z;
+		long double s = 0, t = z;
+		for (unsigned n = 1; s + t/n != s; n += 2) {
+		 s += t/n;
+		 t *= zz;
+		}
+		return k*ln2 + 2*s;
+	}
+
+	/// The Reimann zeta function at an integer m > 1, worked out at compile time by Borwein's algorithm
+	constexpr long double zeta_int(unsigned m)
 	{
-		return sinh(x)/cosh(x);
+		constexpr unsigned n = cvz<long double>::n;
+		long double s = 0, h = 1;
+		for (unsigned k = 0; k < n; ++k) {
+		 long double t = 1;
+		 for (unsigned i = 0; i < m; ++i) t /= k + 1;
+		 s += borwein_weight(n, k)*t;
+		}
+		for (unsigned i = 1; i < m; ++i) h /= 2;
+		return s/(1 - h);
 	}
 
-	/// The angle with a hyperbolic sine of x
-	template <typename num_t> num_t asinh(num_t x)
+	/// Coefficient of x^(n + 1) in the series of lgamma(2 + x) = (1 - gamma)x + (zeta(2) - 1)x^2/2 - ...
+	constexpr long double lgamma_term(unsigned n)
 	{
-		return ln(x + sqrt(x*x + 1));
+		if (0 == n) return 1 - ngamma;
+		const long double c = (zeta_int(n + 1) - 1)/(n + 1);
+		return n & 1 ? c : -c;
 	}
 
-	/// The angle with a hyperbolic cosine of x
-	template <typename num_t> num_t acosh(num_t x)
+	/// Bernoulli numbers B(2), B(4), ... B(24)
+	constexpr std::array<long double, 12> bernoulli = {
+		1/6.0L, -1/30.0L, 1/42.0L, -1/30.0L, 5/66.0L, -691/2730.0L, 7/6.0L,
+		-3617/510.0L, 43867/798.0L, -174611/330.0L, 854513/138.0L, -236364091/2730.0L
+	};
+
+	/// Coefficient B(2n + 2)/((2n + 2)(2n + 1)) of x^-(2n + 1) in Stirling's series
+	constexpr long double stirling_term(unsigned n)
 	{
-		return ln(x + sqrt(x*x - 1));
+		const long double k = 2*n + 2;
+		return bernoulli[n]/(k*(k - 1));
 	}
 
-	/// The angle with a hyperbolic tangent of x
-	template <typename num_t> num_t atanh(num_t x)
+	/// The argument below which lgamma is the series about 2
+	constexpr long double lgamma_bound = 8;
+
+	/// The argument from which Stirling's series is summed
+	constexpr long double stirling_bound = 16;
+
+	/// The coefficients are only known to long double, so more terms than that would not help
+	template <typename num_t> constexpr long double gamma_tolerance = std::max(epsilon<num_t>, epsilon<long double>);
+	template <typename num_t> constexpr unsigned lgamma_terms = terms(lgamma_term, 0.5L, gamma_tolerance<num_t>);
+	template <typename num_t> constexpr unsigned stirling_terms = terms(stirling_term, 1/(stirling_bound*stirling_bound), gamma_tolerance<num_t>);
+	template <typename num_t> constexpr auto lgamma_table = table<num_t, lgamma_terms<num_t>>(lgamma_term);
+	template <typename num_t> constexpr auto stirling_table = table<num_t, stirling_terms<num_t>>(stirling_term);
+
+	/// Coefficient B(2n + 2)/(2n + 2) of x^-(2n + 2) in the asymptotic series of digamma
+	constexpr long double digamma_term(unsigned n)
 	{
-		const num_t a = 0.5, b = 1.0, c = 1.5;
-		return x*hyper(a, b, c, x*x);
+		return bernoulli[n]/(2*n + 2);
 	}
-	
+
+	/// Coefficient B(2n + 2) of x^-(2n + 3) in the asymptotic series of trigamma
+	constexpr long double trigamma_term(unsigned n)
+	{
+		return bernoulli[n];
+	}
+
+	template <typename num_t> constexpr unsigned digamma_terms = terms(digamma_term, 1/(stirling_bound*stirling_bound), gamma_tolerance<num_t>);
+	template <typename num_t> constexpr unsigned trigamma_terms = terms(trigamma_term, 1/(stirling_bound*stirling_bound), gamma_tolerance<num_t>);
+	template <typename num_t> constexpr auto digamma_table = table<num_t, digamma_terms<num_t>>(digamma_term);
+	template <typename num_t> constexpr auto trigamma_table = table<num_t, trigamma_terms<num_t>>(trigamma_term);
+
+	/// lgamma(1 + e) for |e| <= 1/2 by the series about 2, without rounding 1 + e
+	template <typename num_t> constexpr num_t lgamma1p(num_t e)
+	{
+		return e*horner(lgamma_table<num_t>, e) - log1p(e);
+	}
+
+	/// The roots of lgamma beside the poles at -2, -3, ... -21, as offsets from the pole split into hi + lo, those below it first, 0 where there is none
+	constexpr std::array<std::array<long double, 4>, 20> lgamma_roots = {{
+		{ -0x1.d3fe4b007c360abp-2L, 0x1.360cea0e5f9p-68L, 0, 0 },
+		{ -0x1.260dbc9e59af7dc6p-3L, 0x1.96652c26458p-72L, 0x1.025f7af2137f9a1ap-2L, -0x1.5a4b4641eae8p-68L },
+		{ -0x1.4273c2ccac061874p-5L, 0x1.e9e43cfddacp-73L, 0x1.6e3aae0f406bd1e6p-5L, -0x1.1584a448db2cp-70L },
+		{ -0x1.0d4afe16db219526p-7L, -0x1.5b9654e537cp-74L, 0x1.1510b222a0657798p-7L, -0x1.5480ed310ap-73L },
+		{ -0x1.6b25897c8ced81fp-10L, -0x1.6cb68b1c2e64p-75L, 0x1.6d0a6e0bf2a08ac4p-10L, 0x1.4e9a1670904p-75L },
+		{ -0x1.9fef6ff0f5be8906p-13L, 0x1.19233c3eaa5p-79L, 0x1.a044a3c8801853b2p-13L, 0x1.268f700b7838p-78L },
+		{ -0x1.a01459fc9f60cb3cp-16L, -0x1.d839d90aecc8p-81L, 0x1.a01fa98c3c35617ep-16L, -0x1.6a4561953a54p-81L },
+		{ -0x1.71dda3ec36b6c22p-19L, 0x1.23cae21484cp-88L, 0x1.71ded0bf801bcd8cp-19L, -0x1.5749259e7e2p-84L },
+		{ -0x1.27e4eee649ed1766p-22L, 0x1.0f55df0fe7a4p-87L, 0x1.27e50808cbe75462p-22L, 0x1.6beae0e58b6p-90L },
+		{ -0x1.ae6454c5765969cp-26L, 0x1.5bf1b415c68p-96L, 0x1.ae64583932494cb6p-26L, -0x1.6de8c682d27cp-91L },
+		{ -0x1.1eed8ee62acf81ep-29L, -0x1.2879c3c90708p-95L, 0x1.1eed8f18f0437ca6p-29L, 0x1.e161b43a141p-95L },
+		{ -0x1.612461380cd07ba4p-33L, 0x1.1bf0723fdea8p-98L, 0x1.6124613d00d0b4p-33L, 0x1.c54155b96bep-99L },
+		{ -0x1.93974a8bd29cebd8p-37L, -0x1.5c63dd4f8938p-102L, 0x1.93974a8c3cf6b83ep-37L, 0x1.8bba248edc74p-102L },
+		{ -0x1.ae7f3e7337a1c842p-41L, 0x1.e85847394p-110L, 0x1.ae7f3e733f6219fap-41L, -0x1.c7e274dcd634p-106L },
+		{ -0x1.ae7f3e733b428498p-45L, 0x1.b11b83a2154p-114L, 0x1.ae7f3e733bc15da4p-45L, -0x1.cb93444d8a08p-110L },
+		{ -0x1.952c77030ad110eep-49L, 0x1.ad2e2cd89f1p-115L, 0x1.952c77030ad83c78p-49L, -0x1.a8228b8022b4p-114L },
+		{ -0x1.6827863b97d94988p-53L, 0x1.34014d12db68p-118L, 0x1.6827863b97d9a5eep-53L, 0x1.3523679e0dfp-118L },
+		{ -0x1.2f49b46814157036p-57L, -0x1.ec7c7c007178p-122L, 0x1.2f49b46814157462p-57L, 0x1.3668e3dbcf8p-123L },
+		{ -0x1.e542ba402022505p-62L, 0x1.99bae560133p-127L, 0x1.e542ba40202250a6p-62L, 0x1.8df2a87ac08p-132L },
+		{ -0x1.71b8ef6dcf5718bep-66L, 0x1.509566ea6c94p-131L, 0x1.71b8ef6dcf5718cp-66L, 0x1.15b15aa4261cp-131L }
+	}};
+
+	/// The roots split again into hi + lo in the precision of num_t
+	template <typename num_t> constexpr auto lgamma_root_table = [] {
+		std::array<std::array<num_t, 4>, lgamma_roots.size()> r { };
+		for (std::size_t n = 0; n < r.size(); ++n) {
+		 for (std::size_t i = 0; i < 4; i += 2) {
+		  r[n][i] = num_t(lgamma_roots[n][i]);
+		  r[n][i + 1] = num_t((lgamma_roots[n][i] - (long double) r[n][i]) + lgamma_roots[n][i + 1]);
+		 }
+		}
+		return r;
+	}();
+
+	/// lgamma(e - n) for |e| <= 1/2 relative to its root e0 + e0l on the same side of the pole at -n
+	template <typename num_t> constexpr num_t lgamma_root(num_t e, num_t e0, num_t e0l, unsigned n)
+	{
+		// tgamma(e - n) = tgamma(1 + e)/(e (e - 1) ... (e - n)), so each factor of lgamma is taken as its difference from
+		// that at the root, where all of them sum to 0, in terms of d = e - e0, which is exact in the first step
+		const num_t d = (e - e0) - e0l;
+		// The series about 2 by divided differences, q = (e^(k + 1) - e0^(k + 1))/d
+		num_t s = 0, q = 1, p = e0;
+		for (const num_t c : lgamma_table<num_t>) {
+		 s += c*q;
+		 q = e*q + p;
+		 p *= e0;
+		}
+		// The ratio of (1 + e) e (1 - e) ... (n - e) to its value at the root less 1, gathered without rounding the ratio,
+		// but for the factor e/e0 = 1 + d/e0, which cancels once e is much nearer the pole than the root is
+		const num_t z = d/e0;
+		num_t u = d/(1 + e0);
+		for (unsigned j = 1; j <= n; ++j) {
+		 const num_t t = -d/(j - e0);
+		 u += t + u*t;
+		}
+		if (z < num_t(-0.5)) return d*s - log1p(u) - (ln(e/e0) - e0l/e0);
+		return d*s - log1p(u + z + u*z);
+	}
+
+	/// The sine of x, defined with the trigonometric functions below
+	template <typename num_t, typename policy = precise> constexpr num_t sin(num_t x);
+
+	/// The sine of pi x, without the error of rounding pi x for large x, and exactly 0 at the integers
+	template <typename num_t> constexpr num_t sinpi(num_t x)
+	{
+		if constexpr (is_binary<num_t>) {
+			// Taking off an even integer is exact, and so is folding into [-1/2, 1/2]
+			x -= 2*nearbyint(x/2);
+			if (num_t(0.5) < x) x = 1 - x;
+			if (x < num_t(-0.5)) x = -1 - x;
+		}
+		return sin(num_t(pi)*x);
+	}
+
+	/// The natural logarithm of the magnitude of the gamma function
+	template <typename num_t> constexpr num_t lgamma(num_t x)
+	{
+		if constexpr (is_binary<num_t>) {
+			if (isnan(x)) return x;
+			if (isinf(x)) return std::numeric_limits<num_t>::infinity();
+		}
+		if (x < num_t(0.5)) {
+			if constexpr (is_binary<num_t>) {
+				// The reflection cancels near the roots by the poles, so there lgamma is worked out relative to the root
+				const num_t n = nearbyint(-x);
+				if (2 <= n and n <= num_t(lgamma_roots.size() + 1)) {
+				 const auto &r = lgamma_root_table<num_t>[static_cast<std::size_t>(n) - 2];
+				 const num_t e = x + n;
+				 const std::size_t i = e < 0 ? 0 : 2;
+				 if (0 != r[i]) return lgamma_root(e, r[i], r[i + 1], static_cast<unsigned>(n));
+				}
+			}
+			// The poles at the non-positive integers come out infinite
+			if (num_t(-0.5) <= x) return lgamma1p(x) - ln(abs(x));
+			// Reflected by -x, which is exact where 1 - x would be rounded
+			return ln(num_t(pi)/abs(x*sinpi(x))) - lgamma(-x);
+		}
+		if (x < num_t(lgamma_bound)) {
+			// Down to [0.5, 2.5) by lgamma(x) = lgamma(x - 1) + ln(x - 1), whose terms do not cancel
+			num_t r = x, p = 1;
+			while (num_t(2.5) <= r) {
+			 r -= 1;
+			 p *= r;
+			}
+			// Below 1.5 down once more by lgamma(r) = lgamma(r + 1) - ln(r), with both differences exact
+			const bool down = r < num_t(1.5);
+			const num_t e = down ? r - 1 : r - 2;
+			const num_t s = e*horner(lgamma_table<num_t>, e);
+			return (down ? s - log1p(e) : s) + ln(p);
+		}
+		if constexpr (fits_double<num_t>) {
+			const num_t t = x + num_t(lanczos_g - 0.5L);
+			return num_t(lnsqrt2pi) + (x - num_t(0.5))*ln(t) - t + ln(lanczos_sum(x));
+		} else {
+			// Move up by lgamma(x) = lgamma(x + n) - ln(x (x + 1) ... (x + n - 1))
+			num_t p = 1;
+			while (x < num_t(stirling_bound)) {
+			 p *= x;
+			 x += 1;
+			}
+			const num_t r = 1/x;
+			return (x - num_t(0.5))*ln(x) - x + num_t(lnsqrt2pi) + r*horner(stirling_table<num_t>, r*r) - ln(p);
+		}
+	}
+
+	/// Arguments below which tgamma does not overflow, where it is worked out by a product
+	template <typename num_t> constexpr unsigned gamma_bound = [] {
+		// The first n for which ln((n - 1)!) passes the largest exponent, taking double's for types without one
+		using bin_t = std::conditional_t<is_binary<num_t>, num_t, double>;
+		constexpr int e = std::numeric_limits<bin_t>::max_exponent;
+		unsigned n = 1;
+		for (long double s = 0; s < e*ln2; ++n) s += ln_int(n);
+		return n;
+	}();
+
+	/// Extends factorials into the real numbers, tgamma(n) = (n - 1)!
+	template <typename num_t> constexpr num_t tgamma(num_t x)
+	{
+		if (x < num_t(0.5)) {
+			// Near 0 by tgamma(x) = tgamma(1 + x)/x, and below by reflection with -x, which is exact where 1 - x would be rounded
+			if (num_t(-0.5) <= x) return exp(lgamma1p(x))/x;
+			const num_t s = sinpi(x);
+			if constexpr (is_binary<num_t>) {
+				// Poles at the negative integers have no sign
+				if (0 == s) return std::numeric_limits<num_t>::quiet_NaN();
+			}
+			return -num_t(pi)/(x*s*tgamma(-x));
+		}
+		if constexpr (is_binary<num_t>) {
+			if (num_t(stirling_bound) <= x and x < num_t(gamma_bound<num_t>)) {
+				// Stirling's series, with (x - 1/2) ln(x) - x kept to twice the precision, since exp magnifies its rounding by as much
+				num_t l, e, f;
+				const num_t h = ln_extended(x, l);
+				const num_t y = x - num_t(0.5);
+				const num_t p = two_product(y, h, e);
+				const num_t q = two_sum(p, -x, f);
+				const num_t r = 1/x;
+				return exp(q)*exp(f + e + y*l + num_t(lnsqrt2pi) + r*horner(stirling_table<num_t>, r*r));
+			}
+		}
+		if (x < num_t(gamma_bound<num_t>)) {
+			// Down to [0.5, 2.5) where exp(lgamma(r)) is precise, then up again by tgamma(r + 1) = r tgamma(r)
+			num_t r = x;
+			while (num_t(2.5) <= r) r -= 1;
+			num_t p = exp(lgamma(r));
+			while (r < x) {
+			 p *= r;
+			 r += 1;
+			}
+			return p;
+		}
+		// Rounding in lgamma grows with it, so this is less precise, but for binary types it overflows anyway
+		return exp(lgamma(x));
+	}
+
+	/// tgamma(1 + a) - 1, without the cancellation of the difference for small a
+	template <typename num_t> constexpr num_t tgamma1pm1(num_t a)
+	{
+		if (a < num_t(-0.5) or num_t(1.5) < a) return tgamma(1 + a) - 1;
+		// lgamma(1 + a) by the series about 2, taking off log1p(a) below 1/2 as in lgamma
+		if (a < num_t(0.5)) return expm1(lgamma1p(a));
+		const num_t e = a - 1;
+		return expm1(e*horner(lgamma_table<num_t>, e));
+	}
+
+	/// lgamma(a) less Stirling's (a - 1/2) ln(a) - a + ln(sqrt(2 pi)), for a >= 1, summed as such from stirling_bound
+	template <typename num_t> constexpr num_t stirling_error(num_t a)
+	{
+		if (a < num_t(stirling_bound)) return lgamma(a) - (a - num_t(0.5))*ln(a) + a - num_t(lnsqrt2pi);
+		const num_t r = 1/a;
+		return r*horner(stirling_table<num_t>, r*r);
+	}
+
+	/// The derivative of lgamma, tgamma'(x)/tgamma(x), which has poles at the non-positive integers
+	template <typename num_t> constexpr num_t digamma(num_t x)
+	{
+		if constexpr (is_binary<num_t>) {
+			if (isnan(x)) return x;
+		}
+		if (x < num_t(0.5)) {
+			// Reflection by digamma(1 - x) - digamma(x) = pi cot(pi x)
+			return digamma(1 - x) - num_t(pi)*sinpi(x + num_t(0.5))/sinpi(x);
+		}
+		// Up by digamma(x) = digamma(x + 1) - 1/x to where the asymptotic series holds
+		num_t s = 0;
+		while (x < num_t(stirling_bound)) {
+		 s += 1/x;
+		 x += 1;
+		}
+		const num_t r = 1/(x*x);
+		return ln(x) - 1/(2*x) - r*horner(digamma_table<num_t>, r) - s;
+	}
+
+	/// The derivative of digamma, the second of lgamma
+	template <typename num_t> constexpr num_t trigamma(num_t x)
+	{
+		if constexpr (is_binary<num_t>) {
+			if (isnan(x)) return x;
+		}
+		if (x < num_t(0.5)) {
+			// Reflection by trigamma(1 - x) + trigamma(x) = (pi/sin(pi x))^2
+			const num_t c = num_t(pi)/sinpi(x);
+			return c*c - trigamma(1 - x);
+		}
+		// Up by trigamma(x) = trigamma(x + 1) + 1/x^2
+		num_t s = 0;
+		while (x < num_t(stirling_bound)) {
+		 s += 1/(x*x);
+		 x += 1;
+		}
+		const num_t r = 1/(x*x);
+		return (1 + 1/(2*x) + r*horner(trigamma_table<num_t>, r))/x + s;
+	}
+
+	/// The natural logarithm of n!, for n beyond the reach of fact
+	template <typename num_t> constexpr num_t lfact(num_t n)
+	{
+		return lgamma(n + 1);
+	}
+
+	/// The natural logarithm of perm(n, k), for n beyond its reach
+	template <typename num_t> constexpr num_t lperm(num_t n, num_t k)
+	{
+		return lgamma(n + 1) - lgamma(n - k + 1);
+	}
+
+	/// The natural logarithm of comb(n, k), for n beyond its reach
+	template <typename num_t> constexpr num_t lcomb(num_t n, num_t k)
+	{
+		return lgamma(n + 1) - lgamma(k + 1) - lgamma(n - k + 1);
+	}
+
+	// The regularized incomplete gamma functions share the prefactor
+	// x^a e^-x/tgamma(a), whose logarithm is a difference of terms of size
+	// a ln(a). As in Temme and in DiDonato and Morris it is split into a
+	// factor of a alone, sqrt(a/(2 pi)) e^-stirling_error(a), and the rest,
+	// e^(a log1pmx((x - a)/a)), neither of which cancels. Below a = 1 the
+	// factor is a/tgamma(1 + a) and the rest e^(a ln(x) - x) instead, and
+	// below stirling_bound the factor is a^a e^-a/tgamma(a) directly. The
+	// series and the fraction take O(sqrt(a)) terms near x = a, so for large
+	// a they are left for x far from a, and near it the smaller tail is
+	// Temme's uniform expansion in erfc and powers of 1/a, whose coefficients
+	// are worked out when the table is made.
+
+	/// The factor of the prefactor of the incomplete gamma functions that depends on a alone, e^-gamma_exponent(a, x) x^a e^-x/tgamma(a)
+	template <typename num_t> constexpr num_t gamma_scale(num_t a)
+	{
+		// For a < 1, lgamma(a) grows to -ln(a), and its rounding with it, so a/tgamma(1 + a) is taken whole
+		if (a < 1) return a/(1 + tgamma1pm1(a));
+		if constexpr (is_binary<num_t>) {
+			if (a < num_t(stirling_bound)) {
+				// a^a e^-a/tgamma(a), with a ln(a) - a kept to twice the precision as in tgamma, where stirling_error cancels
+				num_t l, e, f;
+				const num_t h = ln_extended(a, l);
+				const num_t p = two_product(a, h, e);
+				const num_t q = two_sum(p, -a, f);
+				return exp(q)*exp(f + e + a*l)/tgamma(a);
+			}
+		}
+		return sqrt(a)*exp(-stirling_error(a))/num_t(sqrt2pi);
+	}
+
+	/// The logarithm of the prefactor of the incomplete gamma functions over gamma_scale(a)
+	template <typename num_t> constexpr num_t gamma_exponent(num_t a, num_t x)
+	{
+		if (a < 1) return a*ln(x) - x;
+		// a (ln(x/a) - (x - a)/a)
+		return log1pmx(a, x, x - a);
+	}
+
+	/// The factor x^a e^-x/tgamma(a) shared by the regularized incomplete gamma functions, given c = gamma_scale(a)
+	template <typename num_t> constexpr num_t gamma_prefactor(num_t a, num_t x, num_t c)
+	{
+		return c*exp(gamma_exponent(a, x));
+	}
+
+	/// The factor x^a e^-x/tgamma(a) shared by the regularized incomplete gamma functions
+	template <typename num_t> constexpr num_t gamma_prefactor(num_t a, num_t x)
+	{
+		return gamma_prefactor(a, x, gamma_scale(a));
+	}
+
+	/// Power series of the lower regularized gamma function times f over its prefactor, quick for x < a + 1
+	template <typename num_t> constexpr num_t gamma_series(num_t a, num_t x, num_t f)
+	{
+		num_t t = 1/a;
+		return f*sum<num_t>([&] {
+		 const num_t u = t;
+		 t *= x;
+		 t /= ++a;
+		 return u;
+		});
+	}
+
+	/// Power series of the lower regularized gamma function, quick for x < a + 1
+	template <typename num_t> constexpr num_t gamma_series(num_t a, num_t x)
+	{
+		return gamma_series(a, x, gamma_prefactor(a, x));
+	}
+
+	/// Continued fraction of the upper regularized gamma function times f over its prefactor, quick for x > a + 1
+	template <typename num_t> constexpr num_t gamma_fraction(num_t a, num_t x, num_t f)
+	{
+		// 1/(x + 1 - a - 1(1 - a)/(x + 3 - a - 2(2 - a)/(x + 5 - a - ...)))
+		num_t n = 0;
+		num_t b = x - 1 - a;
+		return f*fraction<num_t>(0, [&] {
+		 const num_t an = 0 == n ? 1 : n*(a - n);
+		 ++n;
+		 b += 2;
+		 return std::pair(an, b);
+		});
+	}
+
+	/// Continued fraction of the upper regularized gamma function, quick for x > a + 1
+	template <typename num_t> constexpr num_t gamma_fraction(num_t a, num_t x)
+	{
+		return gamma_fraction(a, x, gamma_prefactor(a, x));
+	}
+
+	/// The argument below which Q(a, x) for a < 1 is gamma_small_upper, whose sum cancels beyond it
+	constexpr long double gamma_small_bound = 1.1;
+
+	/// The upper regularized gamma function for a < 1 and small x, where 1 - P(a, x) would cancel
+	template <typename num_t> constexpr num_t gamma_small_upper(num_t a, num_t x)
+	{
+		// As in Temme and in DiDonato and Morris, tgamma(a) Q(a, x) = tgamma(a) - x^a/a - x^a sum (-x)^n/(n! (a + n)),
+		// where tgamma(a) - x^a/a = (tgamma1pm1(a) - powm1(x, a))/a is worked out without the 1s in either
+		const num_t g = tgamma1pm1(a);
+		const num_t p = expm1(a*ln(x));
+		num_t t = 1, n = 0;
+		const num_t s = sum<num_t>([&] {
+		 ++n;
+		 t *= -x/n;
+		 return t/(a + n);
+		});
+		return (g - p - a*(1 + p)*s)/(1 + g);
+	}
+
+	/// The scaled complement exp(x^2) erfc(x), defined with the error functions below
+	template <typename num_t> constexpr num_t erfcx(num_t x);
+
+	/// The least a, and the greatest |x - a|/a, for which P and Q are Temme's expansion
+	constexpr long double temme_bound = 20;
+	constexpr long double temme_width = 0.4;
+
+	/// Orders of 1/a and of eta kept in Temme's expansion, enough for num_t from temme_bound out to temme_width
+	template <typename num_t> constexpr std::size_t temme_orders = (std::numeric_limits<num_t>::digits + 4)/5;
+	template <typename num_t> constexpr std::size_t temme_terms = 3*std::numeric_limits<num_t>::digits/8 + 1;
+
+	/// Coefficients of eta^n in Temme's c_k(eta), for k < K and n < N
+	template <std::size_t K, std::size_t N> constexpr auto temme_coefficients()
+	{
+		// Each c_k is two terms shorter than the one before it
+		constexpr std::size_t M = N + 2*K;
+		// x/a - 1 = sum b(n) eta^n, from eta^2/2 = x/a - 1 - ln(x/a), whose derivative gives m m' = eta (1 + m) for m = x/a - 1
+		std::array<long double, M + 2> b { };
+		b[1] = 1;
+		for (std::size_t n = 2; n <= M + 1; ++n) {
+		 long double t = b[n - 1];
+		 for (std::size_t i = 2; i < n; ++i) t -= b[i]*(n + 1 - i)*b[n + 1 - i];
+		 b[n] = t/(n + 1);
+		}
+		// eta/m = sum r(n) eta^n
+		std::array<long double, M + 1> r { };
+		r[0] = 1;
+		for (std::size_t n = 1; n <= M; ++n) {
+		 for (std::size_t j = 1; j <= n; ++j) r[n] -= b[j + 1]*r[n - j];
+		}
+		// tgamma(a) = sqrt(2 pi/a) a^a e^-a sum g(k)/a^k, the exponential of Stirling's series
+		std::array<long double, K + 1> g { };
+		g[0] = 1;
+		for (std::size_t k = 1; k <= K; ++k) {
+		 for (std::size_t j = 1; j <= k; j += 2) g[k] += j*stirling_term(static_cast<unsigned>(j - 1)/2)*g[k - j];
+		 g[k] /= k;
+		}
+		// c_0 = 1/m - 1/eta and c_k = c_(k-1)'/eta + (-1)^k g(k)/m, in which the poles at eta = 0 cancel
+		std::array<long double, M> c { };
+		for (std::size_t n = 0; n < M; ++n) c[n] = r[n + 1];
+		std::array<std::array<long double, N>, K> d { };
+		for (std::size_t k = 0; k < K; ++k) {
+		 for (std::size_t n = 0; n < N; ++n) d[k][n] = c[n];
+		 const long double h = k & 1 ? g[k + 1] : -g[k + 1];
+		 for (std::size_t n = 0; n + 2 < M; ++n) c[n] = (n + 2)*c[n + 2] + h*r[n + 1];
+		}
+		return d;
+	}
+
+	template <typename num_t> constexpr auto temme_table = [] {
+		constexpr auto d = temme_coefficients<temme_orders<num_t>, temme_terms<num_t>>();
+		std::array<std::array<num_t, temme_terms<num_t>>, temme_orders<num_t>> c { };
+		for (std::size_t k = 0; k < d.size(); ++k) c[k] = narrow<num_t>(d[k]);
+		return c;
+	}();
+
+	/// Whether Temme's expansion is good to the precision of num_t, since its coefficients are only known to long double
+	template <typename num_t> constexpr bool temme_precise = epsilon<long double> <= epsilon<num_t>;
+
+	/// Whether P(a, x) and Q(a, x) are taken from Temme's expansion
+	template <typename num_t> constexpr bool gamma_temme_covers(num_t a, num_t x)
+	{
+		return num_t(temme_bound) <= a and abs(x - a) < num_t(temme_width)*a;
+	}
+
+	/// The smaller tail, P(a, x) below a and Q(a, x) from it, over e^gamma_exponent(a, x), by Temme's uniform expansion
+	template <typename num_t> constexpr num_t gamma_temme(num_t a, num_t x)
+	{
+		// Q = erfc(eta sqrt(a/2))/2 + R and P = erfc(-eta sqrt(a/2))/2 - R with R = e^(-a eta^2/2)/sqrt(2 pi a) sum c_k(eta)/a^k,
+		// where eta^2/2 = -log1pmx((x - a)/a) and eta takes the sign of x - a
+		const num_t l = log1pmx((x - a)/a);
+		const num_t e = x < a ? -sqrt(-2*l) : sqrt(-2*l);
+		num_t s = 0;
+		for (std::size_t k = temme_orders<num_t>; 0 < k--;) s = s/a + horner(temme_table<num_t>[k], e);
+		const num_t r = s/sqrt(2*num_t(pi)*a);
+		return erfcx(sqrt(-a*l))/2 + (x < a ? -r : r);
+	}
+
+	/// The lower regularized gamma function, P(a, x) = igamma(a, x)/tgamma(a), given c = gamma_scale(a)
+	template <typename num_t> constexpr num_t gammap(num_t a, num_t x, num_t c)
+	{
+		if (x <= 0) return 0;
+		if constexpr (temme_precise<num_t>) {
+			if (gamma_temme_covers(a, x)) {
+			 const num_t s = exp(gamma_exponent(a, x))*gamma_temme(a, x);
+			 return x < a ? s : 1 - s;
+			}
+		}
+		if (x < a + 1) return gamma_series(a, x, gamma_prefactor(a, x, c));
+		return 1 - gamma_fraction(a, x, gamma_prefactor(a, x, c));
+	}
+
+	/// The lower regularized gamma function, P(a, x) = igamma(a, x)/tgamma(a)
+	template <typename num_t> constexpr num_t gammap(num_t a, num_t x)
+	{
+		return gammap(a, x, gamma_scale(a));
+	}
+
+	/// The upper regularized gamma function, Q(a, x) = igammac(a, x)/tgamma(a), given c = gamma_scale(a)
+	template <typename num_t> constexpr num_t gammaq(num_t a, num_t x, num_t c)
+	{
+		if (x <= 0) return 1;
+		// The series for P is near 1 for small a, so Q is worked out whole there
+		if (a < 1 and x < num_t(gamma_small_bound)) return gamma_small_upper(a, x);
+		if constexpr (temme_precise<num_t>) {
+			if (gamma_temme_covers(a, x)) {
+			 const num_t s = exp(gamma_exponent(a, x))*gamma_temme(a, x);
+			 return x < a ? 1 - s : s;
+			}
+		}
+		if (x < a + 1) return 1 - gamma_series(a, x, gamma_prefactor(a, x, c));
+		return gamma_fraction(a, x, gamma_prefactor(a, x, c));
+	}
+
+	/// The upper regularized gamma function, Q(a, x) = igammac(a, x)/tgamma(a)
+	template <typename num_t> constexpr num_t gammaq(num_t a, num_t x)
+	{
+		return gammaq(a, x, gamma_scale(a));
+	}
+
+	/// The lower incomplete gamma function
+	template <typename num_t> constexpr num_t igamma(num_t a, num_t x)
+	{
+		return tgamma(a)*gammap(a, x);
+	}
+
+	/// The upper incomplete gamma function (lower's complement)
+	template <typename num_t> constexpr num_t igammac(num_t a, num_t x)
+	{
+		return tgamma(a)*gammaq(a, x);
+	}
+	
+	/// The natural logarithm of the beta function for a, b > 0, which does not overflow where beta does
+	template <typename num_t> constexpr num_t lbeta(num_t a, num_t b)
+	{
+		return lgamma(a) + lgamma(b) - lgamma(a + b);
+	}
+
+	/// Extends combinations into the field of real numbers
+	template <typename num_t> constexpr num_t beta(num_t a, num_t b)
+	{
+		// The gammas overflow long before their ratio does
+		if (num_t(gamma_bound<num_t>) <= a + b) return exp(lbeta(a, b));
+		return tgamma(a)/tgamma(a + b)*tgamma(b);
+	}
+	
+	// The regularized incomplete beta functions share the prefactor
+	// x^a (1 - x)^b/beta(a, b), which is split as for the gamma functions.
+	// About the mean x0 = a/(a + b) it is x0^a y0^b/beta(a, b), a ratio of
+	// gamma_scale factors, times e^(a log1pmx(u) + b log1pmx(v)), in which
+	// a u = (a + b) x - a = -b v so that the linear parts cancel exactly and
+	// nothing is left of lbeta to cancel. The fraction takes O(sqrt(a + b))
+	// terms near the mean, so there, for large a and b, the smaller tail is
+	// the asymptotic expansion of Temme as given by DiDonato and Morris
+	// (BASYM in TOMS 708), whose coefficients follow by recurrence in a/b.
+
+	/// The factor of the prefactor of the incomplete beta functions that depends on a and b alone, x0^a y0^b/beta(a, b) for x0 = a/(a + b)
+	template <typename num_t> constexpr num_t beta_scale(num_t a, num_t b)
+	{
+		// gamma_scale(z) is z^z e^-z/tgamma(z) but 1/tgamma(z) for z < 1, whose z^z e^-z is put back here, where the e^-z cancel
+		const num_t c = a + b;
+		num_t e = 0;
+		if (a < 1) e += a*ln(a) - a;
+		if (b < 1) e += b*ln(b) - b;
+		if (c < 1) e -= c*ln(c) - c;
+		return gamma_scale(a)*gamma_scale(b)/gamma_scale(c)*exp(e);
+	}
+
+	/// The logarithm of the prefactor of the incomplete beta functions over beta_scale(a, b)
+	template <typename num_t> constexpr num_t beta_exponent(num_t a, num_t b, num_t x)
+	{
+		// a ln(x/x0) + b ln(y/y0), each with the same distance from the mean
+		const num_t c = a + b;
+		num_t d = c*x - a;
+		if constexpr (is_binary<num_t>) {
+			// Near the mean d is the difference of two large numbers, so a + b and its product are kept to twice the precision
+			num_t cl, pl;
+			const num_t p = two_product(two_sum(a, b, cl), x, pl);
+			d = (p - a) + (pl + cl*x);
+		}
+		return log1pmx(a, c*x, d) + log1pmx(b, c*(1 - x), -d);
+	}
+
+	/// The factor x^a (1 - x)^b/beta(a, b) shared by the regularized incomplete beta functions, given c = beta_scale(a, b)
+	template <typename num_t> constexpr num_t beta_prefactor(num_t a, num_t b, num_t x, num_t c)
+	{
+		return c*exp(beta_exponent(a, b, x));
+	}
+
+	/// The factor x^a (1 - x)^b/beta(a, b) shared by the regularized incomplete beta functions
+	template <typename num_t> constexpr num_t beta_prefactor(num_t a, num_t b, num_t x)
+	{
+		return beta_prefactor(a, b, x, beta_scale(a, b));
+	}
+
+	/// Continued fraction of the lower regularized beta function, quick for x < (a + 1)/(a + b + 2)
+	template <typename num_t> constexpr num_t beta_fraction(num_t a, num_t b, num_t x)
+	{
+		// 1/(1 + d1/(1 + d2/(1 + ...))) with odd and even steps
+		unsigned k = 0;
+		return fraction<num_t>(0, [&] {
+		 const num_t m = k/2;
+		 num_t d = 1;
+		 if (k & 1) {
+		  // d(2m + 1) = -(a + m)(a + b + m)x/((a + 2m)(a + 2m + 1))
+		  d = -(a + m)*(a + b + m)*x/((a + 2*m)*(a + 2*m + 1));
+		 } else if (k) {
+		  // d(2m) = m(b - m)x/((a + 2m - 1)(a + 2m))
+		  d = m*(b - m)*x/((a + 2*m - 1)*(a + 2*m));
+		 }
+		 ++k;
+		 return std::pair<num_t, num_t>(d, 1);
+		});
+	}
+
+	/// The least a and b, and the greatest |(a + b) x - a|/min(a, b), for which I_x(a, b) is the asymptotic expansion
+	constexpr long double beta_temme_bound = 100;
+	constexpr long double beta_temme_width = 0.03;
+
+	/// Orders of 1/min(a, b) kept in the asymptotic expansion of I_x(a, b), an even number
+	template <typename num_t> constexpr std::size_t beta_temme_orders = (std::numeric_limits<num_t>::digits + 7)/6*2;
+
+	/// Whether I_x(a, b) and its complement are taken from the asymptotic expansion
+	template <typename num_t> constexpr bool beta_temme_covers(num_t a, num_t b, num_t x)
+	{
+		const num_t m = a < b ? a : b;
+		return num_t(beta_temme_bound) <= m and abs((a + b)*x - a) <= num_t(beta_temme_width)*m;
+	}
+
+	/// The smaller tail, I_x(a, b) below the mean and its complement from it, over beta_prefactor(a, b, x), by the asymptotic expansion
+	template <typename num_t> constexpr num_t beta_temme(num_t a, num_t b, num_t x)
+	{
+		constexpr std::size_t N = beta_temme_orders<num_t>;
+		constexpr num_t e1 = 0.353553390593273762200422181052424519L; // 2^(-3/2)
+		// The tail is 2/sqrt(pi) e^-f e^-bcorr sum d(n) w^n J(n), f = -beta_exponent(a, b, x), with J(n) by recurrence from erfcx(sqrt(f));
+		// the complement is the same expansion with a and b swapped, which turns only the sign of b - a
+		const num_t f = -beta_exponent(a, b, x);
+		const num_t c = a + b;
+		if (a < c*x) std::swap(a, b);
+		const num_t m = a < b ? a : b;
+		const num_t h = m/(c - m);
+		const num_t r0 = 1/(1 + h);
+		const num_t r1 = (b - a)/(c - m);
+		const num_t w0 = 1/sqrt(m*(1 + h));
+		// a0 are the coefficients of the exponent in powers of the distance from the mean, b0 those of its powers, and d those of the tail
+		std::array<num_t, N + 1> a0 { }, b0 { }, c0 { }, d { };
+		a0[0] = 2*r1/3;
+		c0[0] = -a0[0]/2;
+		d[0] = -c0[0];
+		const num_t z0 = sqrt(f), z2 = 2*f;
+		num_t j0 = erfcx(z0)/num_t(4*rsqrtpi), j1 = e1;
+		num_t s = j0 + d[0]*w0*j1;
+		num_t t = 1, hn = 1, w = w0, zm = z0/(2*e1), zn = z2;
+		for (std::size_t n = 2; n <= N; n += 2) {
+		 hn *= h*h;
+		 a0[n - 1] = 2*r0*(1 + h*hn)/(n + 2);
+		 t += hn;
+		 a0[n] = 2*r1*t/(n + 3);
+		 for (std::size_t i = n; i <= n + 1; ++i) {
+		  const num_t r = -num_t(i + 1)/2;
+		  b0[0] = r*a0[0];
+		  for (std::size_t k = 2; k <= i; ++k) {
+		   num_t u = 0;
+		   for (std::size_t j = 1; j < k; ++j) u += (j*r - num_t(k - j))*a0[j - 1]*b0[k - j - 1];
+		   b0[k - 1] = r*a0[k - 1] + u/k;
+		  }
+		  c0[i - 1] = b0[i - 1]/(i + 1);
+		  num_t v = 0;
+		  for (std::size_t j = 1; j < i; ++j) v += d[i - j - 1]*c0[j - 1];
+		  d[i - 1] = -(v + c0[i - 1]);
+		 }
+		 j0 = e1*zm + num_t(n - 1)*j0;
+		 j1 = e1*zn + num_t(n)*j1;
+		 zm *= z2;
+		 zn *= z2;
+		 w *= w0;
+		 const num_t t0 = d[n - 1]*w*j0;
+		 w *= w0;
+		 const num_t t1 = d[n]*w*j1;
+		 s += t0 + t1;
+		 if (abs(t0) + abs(t1) <= num_t(epsilon<num_t>)*s) break;
+		}
+		// Over the prefactor sqrt(a b/(2 pi c)) e^-bcorr e^-f
+		return 2*sqrt(2*c/(a*b))*s;
+	}
+
+	/// The lower regularized beta function, I_x(a, b) = ibeta(a, b, x)/beta(a, b), given c = beta_scale(a, b)
+	template <typename num_t> constexpr num_t betai(num_t a, num_t b, num_t x, num_t c)
+	{
+		if (x <= 0) return 0;
+		if (1 <= x) return 1;
+		const num_t f = beta_prefactor(a, b, x, c);
+		// The expansion needs erfcx, which is only for binary types
+		if constexpr (is_binary<num_t>) {
+			if (beta_temme_covers(a, b, x)) {
+			 const num_t s = f*beta_temme(a, b, x);
+			 return a < (a + b)*x ? 1 - s : s;
+			}
+		}
+		// The fraction converges quickly only below the mean, so use the symmetry above it
+		if (x*(a + b + 2) < a + 1) return f*beta_fraction(a, b, x)/a;
+		return 1 - f*beta_fraction(b, a, 1 - x)/b;
+	}
+
+	/// The lower regularized beta function, I_x(a, b) = ibeta(a, b, x)/beta(a, b)
+	template <typename num_t> constexpr num_t betai(num_t a, num_t b, num_t x)
+	{
+		return betai(a, b, x, beta_scale(a, b));
+	}
+
+	/// The upper regularized beta function, 1 - I_x(a, b) = I_(1-x)(b, a)
+	template <typename num_t> constexpr num_t betaic(num_t a, num_t b, num_t x)
+	{
+		return betai(b, a, 1 - x);
+	}
+
+	/// The lower incomplete beta function
+	template <typename num_t> constexpr num_t ibeta(num_t a, num_t b, num_t x)
+	{
+		return beta(a, b)*betai(a, b, x);
+	}
+
+	/// The upper incomplete beta function (lower's complement)
+	template <typename num_t> constexpr num_t ibetac(num_t a, num_t b, num_t x)
+	{
+		return beta(a, b)*betaic(a, b, x);
+	}
+
+	/// The Dirichlet eta function for real x > 0, summed by the accumulator or accelerator given
+	template <typename num_t, template <typename> class accumulator = neumaier> constexpr num_t eta(num_t x, num_t eps=1e-9)
+	{
+		uintmax_t n = 0;
+		return sum<num_t, accumulator>([&] {
+		 const num_t t = pow<num_t>(++n, -x);
+		 return n & 1 ? t : -t;
+		}, eps, std::numeric_limits<unsigned>::max());
+	}
+
+	// Borwein's algorithm sums the alternating series of eta with weights
+	// that make the error fall as (3 + sqrt 8)^-n after n terms, so about a
+	// score of terms is enough for double. The weights and the logarithms of
+	// the bases depend only on the type, so they are tabulated at compile
+	// time and each term is then one exp.
+
+	/// Terms of Borwein's series for zeta, enough for the precision of the type
+	template <typename num_t> constexpr unsigned zeta_terms = cvz<num_t>::n;
+
+	template <typename num_t> constexpr auto zeta_table = table<num_t, zeta_terms<num_t>>([](unsigned k) { return borwein_weight(zeta_terms<num_t>, k); });
+	template <typename num_t> constexpr auto zeta_logs = table<num_t, zeta_terms<num_t>>([](unsigned k) { return ln_int(k + 1); });
+
+	/// The Reimann zeta function for real x >= 0 other than the pole at 1, by Borwein's algorithm
+	template <typename num_t> constexpr num_t zeta(num_t x)
+	{
+		// The first base is 1, whatever x is
+		num_t s = zeta_table<num_t>[0];
+		for (unsigned k = 1; k < zeta_terms<num_t>; ++k) {
+		 s += zeta_table<num_t>[k]*exp(-x*zeta_logs<num_t>[k]);
+		}
+		// eta(x) = (1 - 2^(1 - x)) zeta(x), with the factor taken without cancellation near the pole
+		return s/-expm1((1 - x)*num_t(ln2));
+	}
+
+	/// The Reimann zeta function for real x > 1, using Euler's product
+	template <typename num_t> num_t zeta_p(num_t x, num_t eps=1e-9)
+	{
+		num_t s = 1;
+		for (const auto q : primes()) {
+		 const num_t t = pow<num_t>(q, -x);
+		 s *= 1 - t;
+		 if (t <= eps) break;
+		}
+		return 1/s;
+	}
+
+	/// The Reimann zeta function for real x > 1, Dirichlet's eta identity
+	template <typename num_t> constexpr num_t zeta_e(num_t x, num_t eps=1e-9)
+	{
+		// Better convergence with eta identity
+		return eta(x, eps)/(1 - exp2(1 - x));
+	}
+
+	/// The Gaussian hypergeometric function, summed by the accumulator or accelerator given
+	template <typename num_t, template <typename> class accumulator = neumaier> constexpr num_t hyper(num_t a, num_t b, num_t c, num_t x)
+	{
+		uintmax_t n = 0;
+		num_t t = 1;
+		return sum<num_t, accumulator>([&] {
+		 const num_t u = t;
+		 t *= a++;
+		 t /= c++;
+		 t *= b++;
+		 t /= ++n;
+		 t *= x;
+		 return u;
+		});
+	}
+
+	/// Kummer's confluent hypergeometric function, summed by the accumulator or accelerator given
+	template <typename num_t, template <typename> class accumulator = neumaier> constexpr num_t kummer(num_t a, num_t c, num_t x)
+	{
+		uintmax_t n = 0;
+		num_t t = 1;
+		return sum<num_t, accumulator>([&] {
+		 const num_t u = t;
+		 t *= a++;
+		 t /= c++;
+		 t *= x;
+		 t /= ++n;
+		 return u;
+		});
+	}
+
+	// The error functions. For float and double these are the rational
+	// approximations of Cody (1969) in three pieces: erf(x) = x P(x^2)/Q(x^2)
+	// below 0.46875, then erfc(x) = exp(-x^2) P(x)/Q(x) up to 4, and beyond
+	// that erfc(x) = exp(-x^2)/x (1/sqrt(pi) - P(1/x^2)/(x^2 Q(1/x^2))). So
+	// the tails keep their relative precision, where 1 - erf would cancel.
+	// Other types keep the incomplete gamma functions, erf(x) = P(1/2, x^2),
+	// up to where the continued fraction of Q(1/2, x^2) converges quickly.
+	// Beyond it the fraction is taken without its prefactor, which gives
+	// erfcx directly, and erfc is that times exp(-x^2) split as in Cody's
+	// pieces, so the rounding of x^2 is not magnified by the exponential.
+	// Fast policies of erf take a truncated Taylor series below 0.46875 and
+	// above it Hastings' erf(x) = 1 - t P(t) exp(-x^2), t = 1/(1 + p x), of
+	// Abramowitz and Stegun 7.1.25 or 7.1.26, which have absolute errors of
+	// 2.5e-5 and 1.5e-7, so at most twice that relatively above 0.46875.
+
+	/// Argument below which erf is Cody's first piece and erfc its complement
+	constexpr long double erf_split = 0.46875;
+
+	/// Cody's coefficients for erf(x)/x in x^2 below erf_split, lowest order first
+	constexpr std::array<long double, 5> erf_p = {
+		3.20937758913846947e03L, 3.77485237685302021e02L, 1.13864154151050156e02L,
+		3.16112374387056560e00L, 1.85777706184603153e-1L
+	};
+	constexpr std::array<long double, 5> erf_q = {
+		2.84423683343917062e03L, 1.28261652607737228e03L, 2.44024637934444173e02L,
+		2.36012909523441209e01L, 1
+	};
+
+	/// Cody's coefficients for exp(x^2) erfc(x) in x from erf_split to 4
+	constexpr std::array<long double, 9> erfc_p = {
+		1.23033935479799725e03L, 2.05107837782607147e03L, 1.71204761263407058e03L,
+		8.81952221241769090e02L, 2.98635138197400131e02L, 6.61191906371416295e01L,
+		8.88314979438837594e00L, 5.64188496988670089e-1L, 2.15311535474403846e-8L
+	};
+	constexpr std::array<long double, 9> erfc_q = {
+		1.23033935480374942e03L, 3.43936767414372164e03L, 4.36261909014324716e03L,
+		3.29079923573345963e03L, 1.62138957456669019e03L, 5.37181101862009858e02L,
+		1.17693950891312499e02L, 1.57449261107098347e01L, 1
+	};
+
+	/// Cody's coefficients for the correction to x exp(x^2) erfc(x) = 1/sqrt(pi) in 1/x^2 above 4
+	constexpr std::array<long double, 6> erfc_tail_p = {
+		6.58749161529837803e-4L, 1.60837851487422766e-2L, 1.25781726111229246e-1L,
+		3.60344899949804439e-1L, 3.05326634961232344e-1L, 1.63153871373020978e-2L
+	};
+	constexpr std::array<long double, 6> erfc_tail_q = {
+		2.33520497626869185e-3L, 6.05183413124413191e-2L, 5.27905102951428412e-1L,
+		1.87295284992346725e00L, 2.56852019228982242e00L, 1
+	};
+
+	template <typename num_t> constexpr auto erf_p_table = narrow<num_t>(erf_p);
+	template <typename num_t> constexpr auto erf_q_table = narrow<num_t>(erf_q);
+	template <typename num_t> constexpr auto erfc_p_table = narrow<num_t>(erfc_p);
+	template <typename num_t> constexpr auto erfc_q_table = narrow<num_t>(erfc_q);
+	template <typename num_t> constexpr auto erfc_tail_p_table = narrow<num_t>(erfc_tail_p);
+	template <typename num_t> constexpr auto erfc_tail_q_table = narrow<num_t>(erfc_tail_q);
+
+	/// Kernel of erf(x) for |x| < erf_split
+	template <typename num_t> constexpr numeric_lane num_t erf_kernel(num_t x)
+	{
+		const num_t xx = x*x;
+		return x*horner(erf_p_table<num_t>, xx)/horner(erf_q_table<num_t>, xx);
+	}
+
+	/// Kernel of exp(y^2) erfc(y) for y >= erf_split
+	template <typename num_t> constexpr num_t erfcx_kernel(num_t y)
+	{
+		if (y < 4) return horner(erfc_p_table<num_t>, y)/horner(erfc_q_table<num_t>, y);
+		const num_t z = 1/(y*y);
+		const num_t r = z*horner(erfc_tail_p_table<num_t>, z)/horner(erfc_tail_q_table<num_t>, z);
+		return (num_t(rsqrtpi) - r)/y;
+	}
+
+	/// The factor exp(-y^2), with y^2 split so that its rounding is not magnified by exp
+	template <typename num_t> constexpr num_t exp_square(num_t y)
+	{
+		const num_t h = nearbyint(16*y)/16;
+		return exp(-h*h)*exp(-(y - h)*(y + h));
+	}
+
+	/// Coefficients of erf(x)/x = 2/sqrt(pi) (1 - x^2/3 + x^4/10 - ...) in powers of x^2
+	constexpr long double erf_term(unsigned n)
+	{
+		return (n % 2 ? -2 : 2)*rsqrtpi*inverse_fact(n)/(2*n + 1);
+	}
+
+	template <typename num_t, typename policy> constexpr unsigned erf_terms = terms(erf_term, erf_split*erf_split, tolerance<num_t, policy>);
+	template <typename num_t, typename policy> constexpr auto erf_table = table<num_t, erf_terms<num_t, policy>>(erf_term);
+
+	/// Hastings' coefficients of 7.1.25 in t, and of 7.1.26, lowest order first
+	constexpr long double hastings3_p = 0.47047L;
+	constexpr std::array<long double, 3> hastings3 = { 0.3480242L, -0.0958798L, 0.7478556L };
+	constexpr long double hastings5_p = 0.3275911L;
+	constexpr std::array<long double, 5> hastings5 = {
+		0.254829592L, -0.284496736L, 1.421413741L, -1.453152027L, 1.061405429L
+	};
+
+	template <typename num_t> constexpr auto hastings3_table = narrow<num_t>(hastings3);
+	template <typename num_t> constexpr auto hastings5_table = narrow<num_t>(hastings5);
+
+	/// Terms of Hastings' approximation for a binary type within the tolerance of a policy, or 0 for none
+	template <typename num_t, typename policy> constexpr unsigned hastings_terms =
+		not is_binary<num_t> or tolerance<num_t, policy> < 3e-7L ? 0 : tolerance<num_t, policy> < 5e-5L ? 5 : 3;
+
+	/// Hastings' t P(t), close to exp(y^2) erfc(y) for y >= erf_split, with as many terms as the policy allows
+	template <typename num_t, typename policy> constexpr numeric_lane num_t hastings_kernel(num_t y)
+	{
+		if constexpr (3 == hastings_terms<num_t, policy>) {
+			const num_t t = 1/(1 + num_t(hastings3_p)*y);
+			return t*horner(hastings3_table<num_t>, t);
+		} else {
+			const num_t t = 1/(1 + num_t(hastings5_p)*y);
+			return t*horner(hastings5_table<num_t>, t);
+		}
+	}
+
+	/// exp(y^2) erfc(y) = y/sqrt(pi) times the fraction of Q(1/2, y^2) over its prefactor, for y^2 >= 3/2
+	template <typename num_t> constexpr num_t erfcx_fraction(num_t y)
+	{
+		// Past 1/sqrt(epsilon) the terms after the first are below the precision of num_t, and y^2 could overflow
+		constexpr long double large = 1/sqrt(epsilon<num_t>);
+		if (num_t(large) < y) return num_t(rsqrtpi)/y;
+		return gamma_fraction<num_t>(0.5, y*y, y*num_t(rsqrtpi));
+	}
+
+	/// Measures the complement of the error function (the tails)
+	template <typename num_t> constexpr num_t erfc(num_t x)
+	{
+		if constexpr (fits_double<num_t>) {
+			if (isnan(x)) return x;
+			if (isinf(x)) return x < 0 ? 2 : 0;
+			const num_t y = abs(x);
+			if (y < num_t(erf_split)) return 1 - erf_kernel(x);
+			const num_t r = exp_square(y)*erfcx_kernel(y);
+			return x < 0 ? 2 - r : r;
+		} else {
+			if constexpr (is_binary<num_t>) {
+				if (isnan(x)) return x;
+				if (isinf(x)) return x < 0 ? 2 : 0;
+			}
+			const num_t y = abs(x);
+			const num_t r = y*y < num_t(1.5) ? gammaq<num_t>(0.5, y*y) : exp_square(y)*erfcx_fraction(y);
+			return x < 0 ? 2 - r : r;
+		}
+	}
+
+	/// Measures the area under the bell curve for errors of size x
+	template <typename num_t, typename policy = precise> constexpr num_t erf(num_t x)
+	{
+		if constexpr (0 < hastings_terms<num_t, policy>) {
+			const num_t y = abs(x);
+			if (y < num_t(erf_split)) return x*horner(erf_table<num_t, policy>, x*x);
+			const num_t r = 1 - exp<num_t, policy>(-y*y)*hastings_kernel<num_t, policy>(y);
+			return x < 0 ? -r : r;
+		} else if constexpr (fits_double<num_t>) {
+			if (isnan(x)) return x;
+			if (isinf(x)) return x < 0 ? -1 : 1;
+			const num_t y = abs(x);
+			if (y < num_t(erf_split)) return erf_kernel(x);
+			const num_t r = 1 - exp_square(y)*erfcx_kernel(y);
+			return x < 0 ? -r : r;
+		} else {
+			const num_t p = gammap<num_t>(0.5, x*x);
+			return x < 0 ? -p : p;
+		}
+	}
+
+	/// The scaled complement exp(x^2) erfc(x), which does not underflow in the upper tail
+	template <typename num_t> constexpr num_t erfcx(num_t x)
+	{
+		if constexpr (fits_double<num_t>) {
+			if (isnan(x)) return x;
+			if (isinf(x)) return x < 0 ? -x : 0;
+			if (num_t(erf_split) <= x) return erfcx_kernel(x);
+			if (num_t(-erf_split) < x) return exp(x*x)*(1 - erf_kernel(x));
+			// Reflect with erfc(x) = 2 - erfc(-x), which overflows below about -26.6
+			return 2/exp_square(-x) - erfcx_kernel(-x);
+		} else {
+			if constexpr (is_binary<num_t>) {
+				if (isnan(x)) return x;
+				if (isinf(x)) return x < 0 ? -x : 0;
+			}
+			const num_t y = abs(x);
+			if (y*y < num_t(1.5)) return exp(x*x)*erfc(x);
+			const num_t r = erfcx_fraction(y);
+			return x < 0 ? 2/exp_square(y) - r : r;
+		}
+	}
+
+	/// The bits of 2/pi after the binary point, enough to reduce any long double
+	constexpr std::uint64_t two_over_pi[] =
+	{
+		0xa2f9836e4e441529, 0xfc2757d1f534ddc0, 0xdb6295993c439041, 0xfe5163abdebbc561,
+		0xb7246e3a424dd2e0, 0x06492eea09d1921c, 0xfe1deb1cb129a73e, 0xe88235f52ebb4484,
+		0xe99c7026b45f7e41, 0x3991d639835339f4, 0x9c845f8bbdf9283b, 0x1ff897ffde05980f,
+		0xef2f118b5a0a6d1f, 0x6d367ecf27cb09b7, 0x4f463f669e5fea2d, 0x7527bac7ebe5f17b,
+		0x3d0739f78a5292ea, 0x6bfb5fb11f8d5d08, 0x56033046fc7b6bab, 0xf0cfbc209af4361d,
+		0xa9e391615ee61b08, 0x6599855f14a06840, 0x8dffd8804d732731, 0x06061556ca73a8c9,
+		0x60e27bc08c6b47c4, 0x19c367cddce8092a, 0x8359c4768b961ca6, 0xddaf44d15719053e,
+		0xa5ff07053f7e33e8, 0x32c2de4f98327dbb, 0xc33d26ef6b1e5ef8, 0x9f3a1f35caf27f1d,
+		0x87f121907c7c246a, 0xfa6ed5772d30433b, 0x15c614b59d19c3c2, 0xc4ad414d2c5d000c,
+		0x467d862d71e39ac6, 0x9b0062337cd2b497, 0xa7b4d55537f63ed7, 0x1810a3fc764d2a9d,
+		0x64abd770f87c6357, 0xb07ae715175649c0, 0xd9d63b3884a7cb23, 0x24778ad623545ab9,
+		0x1f001b0af1dfce19, 0xff319f6a1e666157, 0x9947fbacd87f7eb7, 0x652289e83260bfe6,
+		0xcdc4ef09366cd43f, 0x5dd7de16de3b5892, 0x9bde2822d2e88628, 0x4d58e232cac616e3,
+		0x08cb7de050c017a7, 0x1df35be01834132e, 0x6212830148835b8e, 0xf57fb0adf2e91e43,
+		0x4a48d36710d8ddaa, 0x425faece616aa428, 0x0ab499d3f2a6067f, 0x775c83c2a3883c61,
+		0x78738a5a8cafbdd7, 0x6f63a62dcbbff4ef, 0x818d67c12645ca55, 0x36d9cad2a8288d61,
+		0xc277c9121426049b, 0x4612c459c444c5c8, 0x91b24df31700ad43, 0xd4e5492910d5fdfc,
+		0xbe00cc941eeece70, 0xf53e1380f1ecc3e7, 0xb328f8c79405933e, 0x71c1b3092ef3450b,
+		0x9c12887b20ab9fb5, 0x2ec292472f327b6d, 0x550c90a7721fe76b, 0x96cb314a1679e279,
+		0x4189dff49794e884, 0xe6e29731996bed88, 0x365f5f0efdbbb49a, 0x486ca46742727132,
+		0x5d8db8159f09e5bc, 0x25318d3974f71c05, 0x30010c0d68084b58, 0xee2c90aa4702e774,
+		0x24d6bda67df77248, 0x6eef169fa6948ef6, 0x91b45153d1f20acf, 0x3398207e4bf56863,
+		0xb25f3edd035d407f, 0x8985295255c06437, 0x10d86d324832754c, 0x5bd4714e6e5445c1,
+		0x090b69f52ad56614, 0x9d072750045ddb3b, 0xb4c576ea17f9877d, 0x6b49ba271d296996,
+		0xacccc65414ad6ae2, 0x9089d98850722cbe, 0xa4049407777030f3, 0x27fc00a871ea49c2,
+		0x663de06483dd9797, 0x3fa3fd94438c860d, 0xde41319d39928c70, 0xdde7b7173bdf082b,
+		0x3715a0805c93805a, 0x921110d8e80faf80, 0x6c4bffdb0f903876, 0x185915a562bbcb61,
+		0xb989c7bd401004f2, 0xd2277549f6b6ebbb, 0x22dbaa140a2f2689, 0x768364333b091a94,
+		0x0eaa3a51c2a31dae, 0xedaf12265c4dc26d, 0x9c7a2d9756c0833f, 0x03f6f0098c402b99,
+		0x316d07b43915200c, 0x5bc3d8c492f54bad, 0xc6a5ca4ecd37a736, 0xa9e69492ab6842dd,
+		0xde6319ef8c76528b, 0x6837dbfcaba1ae31, 0x15dfa1ae00dafb0c, 0x664d64b705ed3065,
+		0x29bf56573aff47b9, 0xf96af3be75df9328, 0x3080abf68c6615cb, 0x040622fa1de4d9a4,
+		0xb33d8f1b5709cd36, 0xe9424ea4be13b523, 0x331aaaf0a8654fa5, 0xc1d20f3f0bcd785b,
+		0x76f923048b7b7217, 0x8953a6c6e26e6f00, 0xebef584a9bb7dac4, 0xba66aacfcf761d02,
+		0xd12df1b1c1998c77, 0xadc3da4886a05df7, 0xf480c62ff0ac9aec, 0xddbc5c3f6dded01f,
+		0xc790b6db2a3a25a3, 0x9aaf009353ad0457, 0xb6b42d297e804ba7, 0x07da0eaa76a1597b,
+		0x2a12162db7dcfde5, 0xfafedb89fdbe896c, 0x76e4fca90670803e, 0x156e85ff87fd073e,
+		0x2833676186182aea, 0xbd4dafe7b36e6d8f, 0x3967955bbf3148d7, 0x8416df30432dc735,
+		0x6125ce70c9b8cb30, 0xfd6cbfa200a4e46c, 0x05a0dd5a476f21d2, 0x1262845cb9496170,
+		0xe0566b0152993755, 0x50b7d51ec4f1335f, 0x6e13e4305da92e85, 0xc3b21d3632a1a4b7,
+		0x08d4b1ea21f716e4, 0x698f77ff2780030c, 0x2d408da0cd4f99a5, 0x20d3a2b30a5d2f42,
+		0xf9b4cbda11d0be7d, 0xc1db9bbd17ab81a2, 0xca5c6a0817552e55, 0x0027f0147f8607e1,
+		0x640b148d4196debe, 0x872afddab6256b34, 0x897bfef3059ebfb9, 0x4f6a68a82a4a5ac4,
+		0x4fbcf82d985ad795, 0xc7f48d4d0da63a20, 0x5f57a4b13f149538, 0x800120cc86dd71b6,
+		0xdec9f560bf11654d, 0x6b0701acb08cd0c0, 0xb24855510efb1ec3, 0x72953b06a33540c0,
+		0x7bdc06cc45e0fa29, 0x4ec8cad641f3e8de, 0x647cd8649b31bed9, 0xc397a4d45877c5e3,
+		0x6913daf03c3aba46, 0x18465f7555f5bdd2, 0xc6926e5d2eaced44, 0x0e423e1c87c461e9,
+		0xfd29f3d6e7ca7c22, 0x35916fc5e0088dd7, 0xffe26a6ec6fdb0c1, 0x0893745d7cb2ad6b,
+		0x9d6ecd7b723e6a11, 0xc6a9cff7df7329ba, 0xc9b55100b70db2e2, 0x24ba74607de58ad8,
+		0x742c150d0c188194, 0x667e162901767a9f, 0xbefdfdef4556367e, 0xd913d9ecb9ba8bfc,
+		0x97c427a831c36ef1, 0x36c59456a8d8b5a8, 0xb40ecccf2d891234, 0x576f89562ce3ce99,
+		0xb920d6aa5e6b9c2a, 0x3ecc5f114a0bfdfb, 0xf4e16d3b8e2c86e2, 0x84d4e9a9b4fcd1ee,
+		0xefc9352e61392f44, 0x2138c8d91b0afc81, 0x6a4afbd81c2f84b4, 0x538c994ecc2254dc,
+		0x552ad6c6c096190b, 0xb8701a649569605a, 0x26ee523f0f117f11, 0xb5f4f5cbfc2dbc34,
+		0xeebc34cc5de8605e, 0xdd9b8e67ef3392b8, 0x17c99b5861bc57e1, 0xc68351103ed84871,
+		0xdddd1c2da118af46, 0x2c21d7f359987ad9, 0xc0549efa864ffc06, 0x56ae79e536228922,
+		0xad38dc9367aae855, 0x3826829be7caa40d, 0x51b133990ed7a948, 0x0569f0b265a7887f,
+		0x974c8836d1f9b392, 0x214a827b21cf98dc, 0x9f405547dc3a74e1, 0x42eb67df9dfe5fd4,
+		0x5ea4677b7aacbaa2, 0xf65523882b55ba41, 0x086e59862a218347, 0x39e6e389d49ee540,
+		0xfb49e956ffca0f1c, 0x8a59c52bfa94c5c1, 0xd3cfc50fae5adb86, 0xc5476243853b8621,
+		0x94792c8761107b4c, 0x2a1a2c8012bf4390, 0x2688893c78e4c4a8, 0x7bdbe5c23ac4eaf4,
+		0x268a67f7bf920d2b, 0xa365b1933d0b7cbd, 0xdc51a463dd27dde1, 0x6919949a9529a828,
+		0xce68b4ed09209f44, 0xca984e638270237c, 0x7e32b90f8ef5a7e7, 0x561408f1212a9db5,
+		0x4d7e6f5119a5abf9, 0xb5d6df8261dd9602, 0x36169f3ac4a1a283, 0x6ded727a8d39a9b8,
+		0x825c326b5b2746ed, 0x34007700d255f4fc, 0x4d59018071e0e13f, 0x89b295f364a8f1ae,
+		0xa74b38fc4ceab2bb, 0x47270babc3a734ba, 0x6052dd34f8563aeb, 0x7e8a31bb365895b7
+	};
+
+	/// Sixty four bits of 2/pi starting with bit i after the binary point (from 1)
+	constexpr std::uint64_t two_over_pi_bits(int i)
+	{
+		constexpr int size = sizeof two_over_pi/sizeof *two_over_pi;
+		if (i < -62) return 0;
+		if (i < 1) return two_over_pi[0] >> (1 - i);
+		const int q = (i - 1)/64, r = (i - 1)%64;
+		const std::uint64_t a = q < size ? two_over_pi[q] : 0;
+		const std::uint64_t b = q + 1 < size ? two_over_pi[q + 1] : 0;
+		return r ? (a << r) | (b >> (64 - r)) : a;
+	}
+
+	/// Full product of two 64 bit words as the high and low words
+	constexpr std::pair<std::uint64_t, std::uint64_t> mul_wide(std::uint64_t a, std::uint64_t b)
+	{
+		constexpr std::uint64_t half = 0xffffffff;
+		const std::uint64_t a0 = a & half, a1 = a >> 32;
+		const std::uint64_t b0 = b & half, b1 = b >> 32;
+		const std::uint64_t p00 = a0*b0, p01 = a0*b1, p10 = a1*b0, p11 = a1*b1;
+		const std::uint64_t mid = (p00 >> 32) + (p01 & half) + (p10 & half);
+		return { p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32), (mid << 32) | (p00 & half) };
+	}
+
+	/// Payne-Hanek reduction of large positive x = j pi/2 + r, returning r and leaving j mod 4
+	template <typename num_t> constexpr num_t payne_hanek(num_t x, int &j)
+	{
+		// x = M 2^(e - 64) and bits of 2/pi before e - 65 only add multiples of 4
+		int e;
+		const long double m = frexp(static_cast<long double>(x), &e);
+		const auto M = static_cast<std::uint64_t>(ldexp(m, 64));
+		const auto [h0, l0] = mul_wide(M, two_over_pi_bits(e - 65));
+		const auto [h1, l1] = mul_wide(M, two_over_pi_bits(e - 1));
+		const auto [h2, l2] = mul_wide(M, two_over_pi_bits(e + 63));
+		// Product bits 190 and 191 are j and the 128 bits below are the fraction
+		const std::uint64_t p0 = l2;
+		const std::uint64_t p1 = h2 + l1;
+		const std::uint64_t p2 = h1 + l0 + (p1 < l1);
+		std::uint64_t hi = (p2 << 2) | (p1 >> 62);
+		std::uint64_t lo = (p1 << 2) | (p0 >> 62);
+		j = static_cast<int>(p2 >> 62);
+		// Round to the nearest multiple so the fraction lies in [-1/2, 1/2)
+		long double sign = 1;
+		if (hi >> 63) {
+		 j = (j + 1) & 3;
+		 sign = -1;
+		 lo = ~lo + 1;
+		 hi = ~hi + (0 == lo);
+		}
+		constexpr long double a = 0x1.921fb54442d18p+0L + 0x1.1a62633145c07p-54L;
+		constexpr long double b = (0x1.921fb54442d18p+0L - a) + 0x1.1a62633145c07p-54L - 0x1.f1976b7ed8fbcp-110L;
+		// The leading word times pi/2 is kept whole, since it has lost leading bits to the lower word where r is small
+		const long double fh = ldexp(static_cast<long double>(hi), -64), fl = ldexp(static_cast<long double>(lo), -128);
+		long double pl;
+		const long double p = two_product(fh, a, pl);
+		return static_cast<num_t>(sign*(p + (pl + fh*b + fl*a)));
+	}
+
+	/// A constant a + b + c split into hi + mid + lo where n*hi and n*mid are exact for integers n < 2^bits
+	template <typename num_t> struct cody_waite_3
+	{
+		num_t hi, mid, lo;
+
+		constexpr cody_waite_3(double a, double b, double c, int bits)
+		: hi(cody_waite<num_t>::veltkamp(num_t(a), bits))
+		, mid(cody_waite<num_t>::veltkamp(num_t((a - (long double) hi) + b), bits))
+		, lo(num_t(((a - (long double) hi) - mid) + b + c))
+		{ }
+	};
+
+	/// Half of pi split for Cody-Waite reduction of moderate arguments
+	template <typename num_t> constexpr cody_waite_3<num_t> pi_2_cw
+	{
+		0x1.921fb54442d18p+0, 0x1.1a62633145c07p-54, -0x1.f1976b7ed8fbcp-110, std::numeric_limits<num_t>::digits/2
+	};
+
+	/// Whether r = x - n pi/2 by pi_2_cw has kept its precision, which it loses where x is near a multiple of pi/2
+	template <typename num_t> constexpr bool pi_2_cw_holds(num_t n, num_t r)
+	{
+		// pi_2_cw holds about twice the digits of pi/2, so r is off by up to n 2^(2 - 2 digits), which is kept below 2^-(digits + 4) r
+		// unless it is within the 2^-126 of the 128 bit fraction of payne_hanek anyway
+		constexpr int digits = std::numeric_limits<num_t>::digits;
+		constexpr num_t ratio = power_of_2<num_t>(6 - digits), least = power_of_2<num_t>(2*digits - 128);
+		return abs(n)*ratio <= abs(r) or abs(n) <= least;
+	}
+
+	/// Reduces x = j pi/2 + r with |r| <= pi/4, returning r and leaving j mod 4
+	template <typename num_t> constexpr num_t reduce_pi_2(num_t x, int &j)
+	{
+		constexpr int bits = std::numeric_limits<num_t>::digits/2;
+		constexpr auto limit = static_cast<num_t>(std::uint64_t(1) << (bits - 1));
+		if (fabs(x) < limit) {
+			const num_t n = nearbyint(x*num_t(1/pi_2));
+			const num_t r = ((x - n*pi_2_cw<num_t>.hi) - n*pi_2_cw<num_t>.mid) - n*pi_2_cw<num_t>.lo;
+			// Otherwise r is left to Payne-Hanek, which carries 128 bits of the fraction
+			if (pi_2_cw_holds(n, r)) {
+			 j = static_cast<int>(static_cast<long long>(n) & 3);
+			 return r;
+			}
+		}
+		if (x < 0) {
+			const num_t r = payne_hanek(-x, j);
+			j = -j & 3;
+			return -r;
+		}
+		return payne_hanek(x, j);
+	}
+
+	/// Coefficients of (sin(r)/r - 1)/r^2 = -1/3! + r^2/5! - ... in powers of r^2
+	constexpr long double sin_term(unsigned n)
+	{
+		return (n % 2 ? 1 : -1)*inverse_fact(2*n + 3);
+	}
+
+	/// Coefficients of (cos(r) - 1)/r^2 = -1/2! + r^2/4! - ... in powers of r^2
+	constexpr long double cos_term(unsigned n)
+	{
+		return (n % 2 ? 1 : -1)*inverse_fact(2*n + 2);
+	}
+
+	constexpr auto trig_radius = pi_4*pi_4;
+	template <typename num_t, typename policy = precise> constexpr unsigned sin_terms = terms(sin_term, trig_radius, tolerance<num_t, policy>);
+	template <typename num_t, typename policy = precise> constexpr unsigned cos_terms = terms(cos_term, trig_radius, tolerance<num_t, policy>);
+	template <typename num_t, typename policy = precise> constexpr auto sin_table = table<num_t, sin_terms<num_t, policy>>(sin_term);
+	template <typename num_t, typename policy = precise> constexpr auto cos_table = table<num_t, cos_terms<num_t, policy>>(cos_term);
+
+	/// Kernel of sin(r) on the reduced range |r| <= pi/4
+	template <typename num_t, typename policy = precise> constexpr numeric_lane num_t sin_kernel(num_t r)
+	{
+		const num_t rr = r*r;
+		return r + r*rr*horner(sin_table<num_t, policy>, rr);
+	}
+
+	/// Kernel of cos(r) on the reduced range |r| <= pi/4
+	template <typename num_t, typename policy = precise> constexpr numeric_lane num_t cos_kernel(num_t r)
+	{
+		const num_t rr = r*r;
+		return 1 + rr*horner(cos_table<num_t, policy>, rr);
+	}
+
+	/// In a right triangle, the leg opposite an angle over the hypotenuse
+	template <typename num_t, typename policy> constexpr num_t sin(num_t x)
+	{
+		if constexpr (is_binary<num_t>) {
+			if (isinf(x)) return std::numeric_limits<num_t>::quiet_NaN();
+			if (isnan(x)) return x;
+			int j;
+			const num_t r = reduce_pi_2(x, j);
+			const num_t s = j & 1 ? cos_kernel<num_t, policy>(r) : sin_kernel<num_t, policy>(r);
+			return j & 2 ? -s : s;
+		} else {
+			uintmax_t n = 1;
+			const num_t xx = -x*x;
+			num_t t = x;
+			return sum<num_t, neumaier>([&] {
+			 const num_t u = t;
+			 t *= xx;
+			 t /= ++n;
+			 t /= ++n;
+			 return u;
+			}, num_t(tolerance<num_t, policy>));
+		}
+	}
+
+	/// In a right triangle, the leg adjacent an angle over the hypotenuse
+	template <typename num_t, typename policy = precise> constexpr num_t cos(num_t x)
+	{
+		if constexpr (is_binary<num_t>) {
+			if (isinf(x)) return std::numeric_limits<num_t>::quiet_NaN();
+			if (isnan(x)) return x;
+			int j;
+			const num_t r = reduce_pi_2(x, j);
+			const num_t c = j & 1 ? sin_kernel<num_t, policy>(r) : cos_kernel<num_t, policy>(r);
+			return (j + 1) & 2 ? -c : c;
+		} else {
+			uintmax_t n = 0;
+			const num_t xx = -x*x;
+			num_t t = 1;
+			return sum<num_t, neumaier>([&] {
+			 const num_t u = t;
+			 t *= xx;
+			 t /= ++n;
+			 t /= ++n;
+			 return u;
+			}, num_t(tolerance<num_t, policy>));
+		}
+	}
+
+	/// Both the sine and cosine of x from one argument reduction
+	template <typename num_t> constexpr std::pair<num_t, num_t> sincos(num_t x)
+	{
+		if constexpr (is_binary<num_t>) {
+			if (isinf(x)) x = std::numeric_limits<num_t>::quiet_NaN();
+			if (isnan(x)) return { x, x };
+			int j;
+			const num_t r = reduce_pi_2(x, j);
+			const num_t s = sin_kernel(r), c = cos_kernel(r);
+			switch (j) {
+			case 0: return { s, c };
+			case 1: return { c, -s };
+			case 2: return { -s, -c };
+			default: return { -c, s };
+			}
+		} else {
+			return { sin(x), cos(x) };
+		}
+	}
+
+	/// Slope of tangent line on a circle at angle x from the origin
+	template <typename num_t> constexpr num_t tan(num_t x)
+	{
+		const auto [s, c] = sincos(x);
+		return s/c;
+	}
+
+	// The inverse functions. For binary types the arctangent of t in [0, 1]
+	// is that of the nearest point c = k/8 plus atan((t - c)/(1 + t c)) by
+	// the subtraction formula, which leaves a short series in |r| <= 1/16,
+	// and beyond 1 it is pi/2 less the arctangent of the reciprocal. Angles
+	// of the points are tabled as hi + lo along with their complements, so
+	// either case is one lookup and a fixed number of flops. The arcsine and
+	// arccosine are arctangents of x over sqrt(1 - x^2) by atan2. Other types
+	// halve the angle by tan(a/2) = t/(1 + sqrt(1 + t^2)) instead, which needs
+	// no constant of their precision, until the series converges quickly.
+
+	/// Arctangent of x in [0, 1] by Euler's series, sum of 4^n (n!)^2/(2n + 1)! x^(2n + 1)/(1 + x^2)^(n + 1), for the tables
+	constexpr long double atan_euler(long double x)
+	{
+		const long double y = x*x/(1 + x*x);
+		long double t = x/(1 + x*x), s = 0;
+		for (unsigned n = 1; s + t != s; ++n) {
+		 s += t;
+		 t *= 2*n*y/(2*n + 1);
+		}
+		return s;
+	}
+
+	/// Points k/atan_steps about which the arctangent is expanded, and the stride of the tables of their angles
+	constexpr unsigned atan_steps = 8, atan_stride = 2*atan_steps;
+
+	/// The angle of point k for k < atan_stride, and pi/2 less that of point k - atan_stride after, with unused entries 0
+	constexpr long double atan_angle(unsigned k)
+	{
+		if (atan_stride <= k) return atan_steps < k - atan_stride ? 0 : pi_2 - atan_angle(k - atan_stride);
+		return atan_steps < k ? 0 : atan_euler((long double) k/atan_steps);
+	}
+
+	template <typename num_t> constexpr auto atan_hi = table<num_t, 2*atan_stride>(atan_angle);
+	template <typename num_t> constexpr auto atan_lo = table<num_t, 2*atan_stride>([](unsigned k) { return atan_angle(k) - num_t(atan_angle(k)); });
+
+	/// Coefficients of (atan(r)/r - 1)/r^2 = -1/3 + r^2/5 - ... in powers of r^2
+	constexpr long double atan_term(unsigned n)
+	{
+		return (n % 2 ? 1.0L : -1.0L)/(2*n + 3);
+	}
+
+	// The nearest point is within 1/(2 atan_steps) of t, so |r| is too
+	constexpr auto atan_radius = 1.0L/(4*atan_steps*atan_steps);
+	template <typename num_t, typename policy = precise> constexpr unsigned atan_terms = terms(atan_term, atan_radius, tolerance<num_t, policy>);
+	template <typename num_t, typename policy = precise> constexpr auto atan_table = table<num_t, atan_terms<num_t, policy>>(atan_term);
+
+	/// Kernel of atan(t) for t in [0, 1] about the point n/atan_steps, whose angle is entry i, or pi/2 - atan(t) from the complement
+	template <typename num_t, typename policy = precise> constexpr numeric_lane num_t atan_kernel(num_t t, num_t n, unsigned i)
+	{
+		const num_t c = n*(num_t(1)/atan_steps);
+		const num_t r = (t - c)/(1 + t*c);
+		const num_t s = atan_stride <= i ? -r : r;
+		const num_t ss = s*s;
+		return atan_hi<num_t>[i] + (s + (s*ss*horner(atan_table<num_t, policy>, ss) + atan_lo<num_t>[i]));
+	}
+
+	/// The angle of t in [0, 1], or pi/2 less it if turned, for binary types
+	template <typename num_t, typename policy = precise> constexpr num_t atan_reduced(num_t t, bool turned)
+	{
+		const num_t n = nearbyint(t*atan_steps);
+		const unsigned k = static_cast<unsigned>(n);
+		return atan_kernel<num_t, policy>(t, n, turned ? k + atan_stride : k);
+	}
+
+	/// Arctangent returns the angle of a given tangent
+	template <typename num_t, typename policy = precise> constexpr num_t atan(num_t x)
+	{
+		if constexpr (is_binary<num_t>) {
+			if (isnan(x)) return x;
+			const num_t a = fabs(x);
+			const bool turned = 1 < a;
+			return copysign(atan_reduced<num_t, policy>(turned ? 1/a : a, turned), x);
+		} else {
+			// Halve once into (-1, 1), through the reciprocal when past 1 so as not to square x, and twice more to tan(pi/16)
+			num_t t = x;
+			if (1 < abs(x)) {
+			 const num_t u = 1/x;
+			 const num_t w = sqrt(1 + u*u);
+			 t = 1/(u < 0 ? u - w : u + w);
+			} else {
+			 t /= 1 + sqrt(1 + t*t);
+			}
+			for (int n = 0; n < 2; ++n) t /= 1 + sqrt(1 + t*t);
+			const num_t a = 0.5, b = 1.0, c = 1.5;
+			return 8*t*hyper(a, b, c, -t*t);
+		}
+	}
+
+	/// Deduces the quadrant correct angle of a given sine and cosine
+	template <typename num_t, typename policy = precise> constexpr num_t atan2(num_t y, num_t x)
+	{
+		if constexpr (is_binary<num_t>) {
+			if (isnan(x) or isnan(y)) return x + y;
+			const num_t ax = fabs(x), ay = fabs(y);
+			const bool turned = ax < ay;
+			const num_t u = turned ? ax : ay, v = turned ? ay : ax;
+			// Both zero is taken as a tangent of 0 and both infinite as 1, leaving the signs to pick the quadrant
+			const num_t t = 0 == v ? u : isinf(u) ? 1 : u/v;
+			num_t a = atan_reduced<num_t, policy>(t, turned);
+			if (copysign(num_t(1), x) < 0) {
+			 const auto &h = pi_2_cw<num_t>;
+			 a = ((2*h.hi - a) + 2*h.mid) + 2*h.lo;
+			}
+			return copysign(a, y);
+		} else {
+			// Halve the angle, from whichever side avoids cancellation
+			if (0 == y) return x < 0 ? 4*atan(num_t(1)) : num_t(0);
+			const num_t r = sqrt(x*x + y*y);
+			return 2*atan(0 < x ? y/(r + x) : (r - x)/y);
+		}
+	}
+
+	/// Arcsine returns the angle of a given sine
+	template <typename num_t, typename policy = precise> constexpr num_t asin(num_t x)
+	{
+		return atan2<num_t, policy>(x, sqrt((1 - x)*(1 + x)));
+	}
+
+	/// Arccosine returns the angle of a given cosine
+	template <typename num_t, typename policy = precise> constexpr num_t acos(num_t x)
+	{
+		return atan2<num_t, policy>(sqrt((1 - x)*(1 + x)), x);
+	}
+
+	/// Beyond this the exponential of -|x| no longer counts in the hyperbolic functions
+	template <typename num_t> constexpr num_t hyperbolic_limit = std::numeric_limits<num_t>::digits*ln2/2;
+
+	/// Rise of the point on an equilateral hyperbola at half of angle x
+	template <typename num_t> constexpr num_t sinh(num_t x)
+	{
+		if constexpr (is_binary<num_t>) {
+			const num_t a = fabs(x);
+			if (a < hyperbolic_limit<num_t>) {
+			 const num_t t = expm1(a);
+			 return copysign((t + t/(t + 1))/2, x);
+			}
+			// Square a half power so as not to overflow before the result does
+			const num_t h = exp(a/2);
+			return copysign(h/2*h, x);
+		} else {
+			uintmax_t n = 1;
+			const num_t xx = x*x;
+			num_t t = x;
+			return sum<num_t>([&] {
+			 const num_t u = t;
+			 t *= xx;
+			 t /= ++n;
+			 t /= ++n;
+			 return u;
+			});
+		}
+	}
+
+	/// Run of the point on equilateral hyperbola at half of angle x
+	template <typename num_t> constexpr num_t cosh(num_t x)
+	{
+		if constexpr (is_binary<num_t>) {
+			const num_t a = fabs(x);
+			if (a < hyperbolic_limit<num_t>) {
+			 const num_t e = exp(a);
+			 return e/2 + 1/(2*e);
+			}
+			const num_t h = exp(a/2);
+			return h/2*h;
+		} else {
+			uintmax_t n = 0;
+			const num_t xx = x*x;
+			num_t t = 1;
+			return sum<num_t>([&] {
+			 const num_t u = t;
+			 t *= xx;
+			 t /= ++n;
+			 t /= ++n;
+			 return u;
+			});
+		}
+	}
+
+	/// Slope of a line meeting a hyperbola at half of angle x from origin
+	template <typename num_t, typename policy = precise> constexpr num_t tanh(num_t x)
+	{
+		if constexpr (is_binary<num_t>) {
+			const num_t t = expm1<num_t, policy>(-2*fabs(x));
+			return copysign(-t/(2 + t), x);
+		} else {
+			return sinh(x)/cosh(x);
+		}
+	}
+
+	/// Beyond this the 1 under the root no longer counts in the inverse hyperbolic functions, and the square could overflow
+	template <typename num_t> constexpr num_t inverse_hyperbolic_limit = power_of_2<num_t>(std::numeric_limits<num_t>::digits/2 + 1);
+
+	/// The angle with a hyperbolic sine of x
+	template <typename num_t> constexpr num_t asinh(num_t x)
+	{
+		// ln(a + sqrt(a^2 + 1)) = log1p(a + a^2/(1 + sqrt(1 + a^2))), with no cancellation for small a
+		const num_t a = abs(x);
+		if constexpr (is_binary<num_t>) {
+			if (isnan(x) or isinf(x)) return x;
+			const num_t y = a < inverse_hyperbolic_limit<num_t> ? log1p(a + a*a/(1 + sqrt(1 + a*a))) : ln(a) + num_t(ln2);
+			return copysign(y, x);
+		} else {
+			const num_t y = log1p(a + a*a/(1 + sqrt(1 + a*a)));
+			return x < 0 ? -y : y;
+		}
+	}
+
+	/// The angle with a hyperbolic cosine of x
+	template <typename num_t> constexpr num_t acosh(num_t x)
+	{
+		// ln(x + sqrt(x^2 - 1)) = log1p(t + sqrt(2t + t^2)) with t = x - 1, which is exact near 1
+		const num_t t = x - 1;
+		if constexpr (is_binary<num_t>) {
+			if (x < 1) return std::numeric_limits<num_t>::quiet_NaN();
+			if (isnan(x) or isinf(x)) return x;
+			if (inverse_hyperbolic_limit<num_t> <= x) return ln(x) + num_t(ln2);
+		}
+		return log1p(t + sqrt(2*t + t*t));
+	}
+
+	/// The angle with a hyperbolic tangent of x
+	template <typename num_t> constexpr num_t atanh(num_t x)
+	{
+		// ln((1 + x)/(1 - x))/2 = log1p(2x/(1 - x))/2, though near 0 the series of ln is more accurate than log1p
+		if constexpr (is_binary<num_t>) {
+			const num_t a = fabs(x);
+			if (1 == a) return copysign(std::numeric_limits<num_t>::infinity(), x);
+			if (a < num_t(3 - 2*sqrt2)) return x + x*x*x*horner(ln_table<num_t>, x*x);
+			return copysign(log1p(2*a/(1 - a))/2, x);
+		} else {
+			return log1p(2*x/(1 - x))/2;
+		}
+	}
+
+	// Batch forms. These map a span of arguments x into a span of results y
+	// with kernels that have neither branches nor library calls, so that the
+	// loops vectorize. Each lane rounds with the 1.5 2^p shifter and scales
+	// by building powers of 2 from their bits, which only works for the IEEE
+	// float and double formats. Arguments that a lane kernel does not cover
+	// (huge, negative, non-finite) are patched afterwards by the scalar form.
+	// GCC only vectorizes loops of unknown length like these from -O3 or with
+	// -fvect-cost-model=dynamic.
+
+	/// The formats that have lane kernels, the others taking the scalar forms in a batch
+	template <typename num_t> constexpr bool has_lanes = std::is_same_v<num_t, float> or std::is_same_v<num_t, double>;
+
+	/// Layout of the IEEE binary formats that the lane kernels rely on
+	template <typename num_t> struct ieee
+	{
+		static_assert(std::numeric_limits<num_t>::is_iec559);
+
+		using bits = std::conditional_t<sizeof(num_t) == sizeof(std::int32_t), std::int32_t, std::int64_t>;
+
+		static constexpr int mantissa = std::numeric_limits<num_t>::digits - 1;
+		static constexpr bits bias = std::numeric_limits<num_t>::max_exponent - 1;
+		static constexpr bits sign = bits(1) << (8*sizeof(bits) - 1);
+		static constexpr num_t shifter = num_t(3) * (bits(1) << (mantissa - 1));
+
+		/// The power 2^n for n in the normal exponent range
+		static num_t pow2(bits n)
+		{
+			return std::bit_cast<num_t>((n + bias) << mantissa);
+		}
+
+		/// Rounds x with |x| < 2^(p - 1) to an integer, as num_t and in k
+		static num_t round(num_t x, bits &k)
+		{
+			const num_t t = x + shifter;
+			k = std::bit_cast<bits>(t) - std::bit_cast<bits>(shifter);
+			return t - shifter;
+		}
+
+		/// Converts an integer with |k| < 2^(p - 1) to num_t
+		static num_t convert(bits k)
+		{
+			return std::bit_cast<num_t>(std::bit_cast<bits>(shifter) + k) - shifter;
+		}
+
+		/// The magnitude of x with the sign bits of s
+		static num_t copysign(num_t x, bits s)
+		{
+			return std::bit_cast<num_t>((std::bit_cast<bits>(x) & ~sign) | (s & sign));
+		}
+	};
+
+	/// Lane kernel of exp(x) for any x, including those out of range
+	template <typename num_t, typename policy = precise> numeric_lane num_t exp_lane(num_t x)
+	{
+		using limits = std::numeric_limits<num_t>;
+		using traits = ieee<num_t>;
+		constexpr num_t top = (limits::max_exponent + 1)*ln2;
+		constexpr num_t bottom = (limits::min_exponent - limits::digits - 2)*ln2;
+		typename traits::bits k;
+		const num_t n = traits::round(x*num_t(log2e), k);
+		const num_t r = (x - n*ln2_cw<num_t>.hi) - n*ln2_cw<num_t>.lo;
+		// Scale in two steps so neither power leaves the normal range
+		const auto h = k >> 1;
+		const num_t y = (1 + expm1_kernel<num_t, policy>(r))*traits::pow2(h)*traits::pow2(k - h);
+		// Out of range the above is garbage, and is replaced here rather than clamping x, which the compiler turns into branches
+		return x < bottom ? 0 : top < x ? limits::infinity() : y;
+	}
+
+	/// Lane kernel of expm1(x) for any x, including those out of range
+	template <typename num_t, typename policy = precise> numeric_lane num_t expm1_lane(num_t x)
+	{
+		using limits = std::numeric_limits<num_t>;
+		using traits = ieee<num_t>;
+		constexpr num_t top = (limits::max_exponent + 1)*ln2;
+		constexpr num_t bottom = -(limits::digits + 2)*ln2;
+		x = x < bottom ? bottom : x;
+		x = top < x ? top : x;
+		typename traits::bits k;
+		const num_t n = traits::round(x*num_t(log2e), k);
+		const num_t r = (x - n*ln2_cw<num_t>.hi) - n*ln2_cw<num_t>.lo;
+		const num_t p = expm1_kernel<num_t, policy>(r);
+		const auto h = k >> 1;
+		const num_t f = traits::pow2(h)*traits::pow2(k - h);
+		const num_t g = (1 + p)*traits::pow2(h)*traits::pow2(k - h);
+		return limits::digits < k ? g - 1 : f*p + (f - 1);
+	}
+
+	/// Lane kernel of exp2(x) for any x, including those out of range
+	template <typename num_t> numeric_lane num_t exp2_lane(num_t x)
+	{
+		using limits = std::numeric_limits<num_t>;
+		using traits = ieee<num_t>;
+		constexpr num_t top = limits::max_exponent + 1;
+		constexpr num_t bottom = limits::min_exponent - limits::digits - 2;
+		x = x < bottom ? bottom : x;
+		x = top < x ? top : x;
+		typename traits::bits k;
+		const num_t n = traits::round(x, k);
+		const auto h = k >> 1;
+		return (1 + expm1_kernel((x - n)*num_t(ln2)))*traits::pow2(h)*traits::pow2(k - h);
+	}
+
+	/// Lane kernel of ln(x) for normal positive x
+	template <typename num_t, typename policy = precise> numeric_lane num_t ln_lane(num_t x)
+	{
+		using traits = ieee<num_t>;
+		using bits = typename traits::bits;
+		constexpr bits root = std::bit_cast<bits>(num_t(sqrt2/2));
+		constexpr bits mask = (bits(1) << traits::mantissa) - 1;
+		// Move the mantissa into [sqrt(1/2), sqrt(2)) by offsetting the bits
+		const bits i = std::bit_cast<bits>(x) - root;
+		const num_t m = std::bit_cast<num_t>((i & mask) + root);
+		const num_t k = traits::convert(i >> traits::mantissa);
+		return k*ln2_cw<num_t>.hi + (ln_kernel<num_t, policy>(m) + k*ln2_cw<num_t>.lo);
+	}
+
+	/// Lane kernel of pow(x, p) for normal positive x
+	template <typename num_t> numeric_lane num_t pow_lane(num_t x, num_t p)
+	{
+		return exp_lane(ln_lane(x)*p);
+	}
+
+	/// Whether x is covered by the ln and pow lane kernels
+	template <typename num_t> bool ln_covers(num_t x)
+	{
+		using limits = std::numeric_limits<num_t>;
+		return limits::min() <= x and x <= limits::max();
+	}
+
+	/// Lane kernel of sin(x) and cos(x) with j counting quarter turns from x to the kernel
+	template <typename num_t, typename policy = precise> numeric_lane num_t sin_lane(num_t x, typename ieee<num_t>::bits j)
+	{
+		using traits = ieee<num_t>;
+		typename traits::bits k;
+		const num_t n = traits::round(x*num_t(1/pi_2), k);
+		const num_t r = ((x - n*pi_2_cw<num_t>.hi) - n*pi_2_cw<num_t>.mid) - n*pi_2_cw<num_t>.lo;
+		k += j;
+		const num_t s = k & 1 ? cos_kernel<num_t, policy>(r) : sin_kernel<num_t, policy>(r);
+		return std::bit_cast<num_t>(std::bit_cast<typename traits::bits>(s) ^ ((k & 2) << (8*sizeof(num_t) - 2)));
+	}
+
+	/// Lane kernel of tan(x)
+	template <typename num_t> numeric_lane num_t tan_lane(num_t x)
+	{
+		using traits = ieee<num_t>;
+		typename traits::bits k;
+		const num_t n = traits::round(x*num_t(1/pi_2), k);
+		const num_t r = ((x - n*pi_2_cw<num_t>.hi) - n*pi_2_cw<num_t>.mid) - n*pi_2_cw<num_t>.lo;
+		const num_t s = sin_kernel(r), c = cos_kernel(r);
+		return k & 1 ? -c/s : s/c;
+	}
+
+	/// Whether x is covered by the trigonometric lane kernels, which are the Cody-Waite reduction of reduce_pi_2
+	template <typename num_t> bool trig_covers(num_t x)
+	{
+		constexpr int digits = std::numeric_limits<num_t>::digits;
+		constexpr auto limit = static_cast<num_t>(std::uint64_t(1) << (digits/2 - 1));
+		constexpr num_t ratio = power_of_2<num_t>(7 - digits);
+		// y - n is r/(pi/2) to within n 2^(1 - digits), so where it passes with twice the margin of pi_2_cw_holds so does r, and elsewhere the scalar form decides
+		typename ieee<num_t>::bits k;
+		const num_t y = x*num_t(1/pi_2);
+		const num_t n = ieee<num_t>::round(y, k);
+		return std::fabs(x) < limit and std::fabs(n)*ratio <= std::fabs(y - n);
+	}
+
+	/// Lane kernel of sinh(x) for any x
+	template <typename num_t> numeric_lane num_t sinh_lane(num_t x)
+	{
+		using traits = ieee<num_t>;
+		const num_t a = std::fabs(x);
+		const num_t t = expm1_lane(a);
+		const num_t h = exp_lane(a/2);
+		const num_t s = a < hyperbolic_limit<num_t> ? (t + t/(t + 1))/2 : h/2*h;
+		return traits::copysign(s, std::bit_cast<typename traits::bits>(x));
+	}
+
+	/// Lane kernel of cosh(x) for any x
+	template <typename num_t> numeric_lane num_t cosh_lane(num_t x)
+	{
+		const num_t a = std::fabs(x);
+		const num_t e = exp_lane(a);
+		const num_t h = exp_lane(a/2);
+		return a < hyperbolic_limit<num_t> ? e/2 + 1/(2*e) : h/2*h;
+	}
+
+	/// Lane kernel of tanh(x) for any x
+	template <typename num_t, typename policy = precise> numeric_lane num_t tanh_lane(num_t x)
+	{
+		using traits = ieee<num_t>;
+		const num_t t = expm1_lane<num_t, policy>(-2*std::fabs(x));
+		return traits::copysign(-t/(2 + t), std::bit_cast<typename traits::bits>(x));
+	}
+
+	/// Lane kernel of sqrt(x) for any x by Newton's steps on the reciprocal root, since std::sqrt may set errno and then is not vectorized
+	template <typename num_t> numeric_lane num_t sqrt_lane(num_t x)
+	{
+		using limits = std::numeric_limits<num_t>;
+		using traits = ieee<num_t>;
+		using bits = typename traits::bits;
+		constexpr bits magic = sizeof(bits) == sizeof(std::int32_t) ? bits(0x5f375a86) : bits(0x5fe6eb50c7b537a9);
+		constexpr int scale = (limits::digits + 1) & ~1;
+		constexpr int steps = limits::digits < 32 ? 2 : 3;
+		// Lift subnormals by an even power of 2, whose half is taken off at the end
+		const bool tiny = x < limits::min();
+		const num_t z = tiny ? x*traits::pow2(scale) : x;
+		// Halving the bits gives 1/sqrt(z) within a few percent, and each step squares the error
+		num_t y = std::bit_cast<num_t>(magic - (std::bit_cast<bits>(z) >> 1));
+		for (int n = 0; n < steps; ++n) y *= num_t(1.5) - num_t(0.5)*z*y*y;
+		const num_t s = z*y;
+		const num_t r = (s + num_t(0.5)*y*(z - s*s))*(tiny ? traits::pow2(-scale/2) : 1);
+		// Zero and infinity are their own roots, while negatives have none
+		const num_t w = x < 0 ? limits::quiet_NaN() : r;
+		return 0 == x or limits::max() < x ? x : w;
+	}
+
+	/// Lane kernel of the angle of t in [0, 1], or pi/2 less it if turned, for any t including NaN
+	template <typename num_t, typename policy = precise> numeric_lane num_t atan_reduced_lane(num_t t, bool turned)
+	{
+		using traits = ieee<num_t>;
+		typename traits::bits k;
+		const num_t n = traits::round(t*atan_steps, k);
+		// A NaN leaves k as garbage, which the mask keeps within the table, and it carries on through r
+		const unsigned i = static_cast<unsigned>(k & (atan_stride - 1)) + (turned ? atan_stride : 0);
+		return atan_kernel<num_t, policy>(t, n, i);
+	}
+
+	/// Lane kernel of atan(x) for any x
+	template <typename num_t, typename policy = precise> numeric_lane num_t atan_lane(num_t x)
+	{
+		using traits = ieee<num_t>;
+		const num_t a = std::fabs(x);
+		const bool turned = 1 < a;
+		const num_t y = atan_reduced_lane<num_t, policy>(turned ? 1/a : a, turned);
+		return traits::copysign(y, std::bit_cast<typename traits::bits>(x));
+	}
+
+	/// Lane kernel of atan2(y, x) for any y and x
+	template <typename num_t, typename policy = precise> numeric_lane num_t atan2_lane(num_t y, num_t x)
+	{
+		using traits = ieee<num_t>;
+		const auto &h = pi_2_cw<num_t>;
+		const num_t ax = std::fabs(x), ay = std::fabs(y);
+		const bool turned = ax < ay;
+		const num_t u = turned ? ax : ay, v = turned ? ay : ax;
+		// As in the scalar form, with any NaN carried through u or u/v
+		const num_t q = 0 == v ? u : u/v;
+		const num_t t = std::numeric_limits<num_t>::max() < u and u == v ? 1 : q;
+		const num_t a = atan_reduced_lane<num_t, policy>(t, turned);
+		const num_t b = ((2*h.hi - a) + 2*h.mid) + 2*h.lo;
+		const auto sx = std::bit_cast<typename traits::bits>(x);
+		return traits::copysign(sx < 0 ? b : a, std::bit_cast<typename traits::bits>(y));
+	}
+
+	/// Lane kernel of asin(x) for any x
+	template <typename num_t, typename policy = precise> numeric_lane num_t asin_lane(num_t x)
+	{
+		return atan2_lane<num_t, policy>(x, sqrt_lane((1 - x)*(1 + x)));
+	}
+
+	/// Lane kernel of acos(x) for any x
+	template <typename num_t, typename policy = precise> numeric_lane num_t acos_lane(num_t x)
+	{
+		return atan2_lane<num_t, policy>(sqrt_lane((1 - x)*(1 + x)), x);
+	}
+
+	/// Lane kernel of log1p(z) for z > -1, with 1 + z normal, up to the largest normal
+	template <typename num_t> numeric_lane num_t log1p_lane(num_t z)
+	{
+		const num_t u = 1 + z;
+		const num_t l = ln_lane(u)*(z/(u - 1));
+		return 1 == u ? z : l;
+	}
+
+	/// Lane kernel of asinh(x) for finite x
+	template <typename num_t> numeric_lane num_t asinh_lane(num_t x)
+	{
+		using traits = ieee<num_t>;
+		const num_t a = std::fabs(x);
+		const num_t s = log1p_lane(a + a*a/(1 + sqrt_lane(1 + a*a)));
+		const num_t l = ln_lane(a) + num_t(ln2);
+		const num_t y = a < inverse_hyperbolic_limit<num_t> ? s : l;
+		return traits::copysign(y, std::bit_cast<typename traits::bits>(x));
+	}
+
+	/// Lane kernel of acosh(x) for finite x >= 1
+	template <typename num_t> numeric_lane num_t acosh_lane(num_t x)
+	{
+		const num_t t = x - 1;
+		const num_t s = log1p_lane(t + sqrt_lane(2*t + t*t));
+		const num_t l = ln_lane(x) + num_t(ln2);
+		return x < inverse_hyperbolic_limit<num_t> ? s : l;
+	}
+
+	/// Lane kernel of atanh(x) for |x| < 1
+	template <typename num_t> numeric_lane num_t atanh_lane(num_t x)
+	{
+		using traits = ieee<num_t>;
+		const num_t a = std::fabs(x);
+		const num_t s = a + a*a*a*horner(ln_table<num_t>, a*a);
+		const num_t l = log1p_lane(2*a/(1 - a))/2;
+		const num_t y = a < num_t(3 - 2*sqrt2) ? s : l;
+		return traits::copysign(y, std::bit_cast<typename traits::bits>(x));
+	}
+
+	/// Whether x is covered by the asinh lane kernel
+	template <typename num_t> bool asinh_covers(num_t x)
+	{
+		return std::fabs(x) <= std::numeric_limits<num_t>::max();
+	}
+
+	/// Whether x is covered by the acosh lane kernel
+	template <typename num_t> bool acosh_covers(num_t x)
+	{
+		return 1 <= x and x <= std::numeric_limits<num_t>::max();
+	}
+
+	/// Whether x is covered by the atanh lane kernel
+	template <typename num_t> bool atanh_covers(num_t x)
+	{
+		return std::fabs(x) < 1;
+	}
+
+	/// Lane kernel of lgamma(x) for finite x >= 0.5, taking both branches of the scalar form and keeping one
+	template <typename num_t> numeric_lane num_t lgamma_lane(num_t x)
+	{
+		const bool series = x < num_t(lgamma_bound);
+		// Lanczos' series from lgamma_bound up
+		const num_t y = series ? num_t(lgamma_bound) : x;
+		const num_t t = y + num_t(lanczos_g - 0.5L);
+		const num_t l = num_t(lnsqrt2pi) + (y - num_t(0.5))*ln_lane(t) - t + ln_lane(lanczos_sum(y));
+		// Below it down to [0.5, 2.5) in a fixed number of steps
+		num_t r = series ? x : num_t(2), p = 1;
+		for (int k = 2; k < int(lgamma_bound); ++k) {
+		 const bool down = num_t(2.5) <= r;
+		 r = down ? r - 1 : r;
+		 p = down ? p*r : p;
+		}
+		// Only when r < 1.5 it was never moved, so p = 1 and its logarithm can stand in for log1p
+		const bool low = r < num_t(1.5);
+		const num_t e = low ? r - 1 : r - 2;
+		const num_t u = 1 + e, d = u - 1;
+		const num_t m = ln_lane(low ? u : p);
+		const num_t q = low ? -(0 == d ? e : m*(e/d)) : m;
+		return series ? e*horner(lgamma_table<num_t>, e) + q : l;
+	}
+
+	/// Lane kernel of tgamma(x) for 0.5 <= x < lgamma_bound
+	template <typename num_t> numeric_lane num_t tgamma_lane(num_t x)
+	{
+		num_t r = x, p = 1;
+		for (int k = 2; k < int(lgamma_bound); ++k) {
+		 const bool down = num_t(2.5) <= r;
+		 r = down ? r - 1 : r;
+		 p = down ? p*r : p;
+		}
+		const bool low = r < num_t(1.5);
+		const num_t e = low ? r - 1 : r - 2;
+		// tgamma(2 + e) = exp(lgamma(2 + e)) and tgamma(1 + e) = tgamma(2 + e)/(1 + e)
+		const num_t g = exp_lane(e*horner(lgamma_table<num_t>, e));
+		return p*(low ? g/(1 + e) : g);
+	}
+
+	/// Whether x is covered by the lgamma lane kernel
+	template <typename num_t> bool lgamma_covers(num_t x)
+	{
+		return num_t(0.5) <= x and x <= std::numeric_limits<num_t>::max();
+	}
+
+	/// Whether x is covered by the tgamma lane kernel, above which a lane would have no more than the precision of pow
+	template <typename num_t> bool tgamma_covers(num_t x)
+	{
+		return num_t(0.5) <= x and x < num_t(lgamma_bound);
+	}
+
+	/// Lane kernel of exp(y^2) erfc(y) for y >= erf_split, taking both of Cody's upper pieces and keeping one
+	template <typename num_t> numeric_lane num_t erfcx_upper_lane(num_t y)
+	{
+		// Neither piece is clamped to its range, which makes the compiler branch, so the unused one may be inf or NaN
+		const num_t z = 1/(y*y);
+		const num_t r = horner(erfc_p_table<num_t>, y)/horner(erfc_q_table<num_t>, y);
+		const num_t t = z*horner(erfc_tail_p_table<num_t>, z)/horner(erfc_tail_q_table<num_t>, z);
+		return y < 4 ? r : (num_t(rsqrtpi) - t)/y;
+	}
+
+	/// Magnitude beyond which exp(-x^2) underflows and the lane kernels leave erf and erfc to the scalar forms
+	constexpr long double erf_bound = 32;
+
+	/// Lane kernel of exp(-y^2) for 0 <= y < erf_bound, split as in the scalar form
+	template <typename num_t> numeric_lane num_t exp_square_lane(num_t y)
+	{
+		using traits = ieee<num_t>;
+		typename traits::bits k;
+		const num_t h = traits::round(16*y, k)/16;
+		return exp_lane(-h*h)*exp_lane(-(y - h)*(y + h));
+	}
+
+	/// Lane kernel of erf(x) for |x| < erf_bound
+	template <typename num_t, typename policy = precise> numeric_lane num_t erf_lane(num_t x)
+	{
+		using traits = ieee<num_t>;
+		const num_t y = std::fabs(x);
+		if constexpr (0 < hastings_terms<num_t, policy>) {
+			const num_t s = x*horner(erf_table<num_t, policy>, x*x);
+			const num_t r = 1 - exp_lane<num_t, policy>(-y*y)*hastings_kernel<num_t, policy>(y);
+			return y < num_t(erf_split) ? s : traits::copysign(r, std::bit_cast<typename traits::bits>(x));
+		} else {
+			const num_t r = 1 - exp_square_lane(y)*erfcx_upper_lane(y);
+			return y < num_t(erf_split) ? erf_kernel(x) : traits::copysign(r, std::bit_cast<typename traits::bits>(x));
+		}
+	}
+
+	/// Lane kernel of erfc(x) for |x| < erf_bound
+	template <typename num_t> numeric_lane num_t erfc_lane(num_t x)
+	{
+		const num_t y = std::fabs(x);
+		const num_t r = exp_square_lane(y)*erfcx_upper_lane(y);
+		return y < num_t(erf_split) ? 1 - erf_kernel(x) : x < 0 ? 2 - r : r;
+	}
+
+	/// Lane kernel of erfcx(x) for finite x > -erf_bound
+	template <typename num_t> numeric_lane num_t erfcx_lane(num_t x)
+	{
+		const num_t y = std::fabs(x);
+		const num_t r = erfcx_upper_lane(y);
+		const num_t s = exp_lane(x*x)*(1 - erf_kernel(x));
+		return y < num_t(erf_split) ? s : x < 0 ? 2/exp_square_lane(y) - r : r;
+	}
+
+	/// Whether x is covered by the erf and erfc lane kernels
+	template <typename num_t> bool erf_covers(num_t x)
+	{
+		return std::fabs(x) < num_t(erf_bound);
+	}
+
+	/// Whether x is covered by the erfcx lane kernel
+	template <typename num_t> bool erfcx_covers(num_t x)
+	{
+		return num_t(-erf_bound) < x and x <= std::numeric_limits<num_t>::max();
+	}
+
+	/// Points a transform runs through the lane kernel at once, kept aside so that y may be x
+	constexpr std::size_t transform_block = 64;
+
+	/// Applies a lane kernel to each x, then the scalar function where the kernel does not cover x, which may be done in place
+	template <typename num_t, typename lane, typename covers, typename scalar>
+	numeric_lane void transform(std::span<const num_t> x, std::span<num_t> y, lane f, covers c, scalar g)
+	{
+		assert(x.size() <= y.size());
+		constexpr std::size_t m = transform_block;
+		const std::size_t n = x.size();
+		for (std::size_t j = 0; j < n; j += m) {
+		 // The arguments are copied before any of y is written, since the fall back needs them
+		 const std::size_t k = std::min(m, n - j);
+		 num_t t[m];
+		 for (std::size_t l = 0; l < k; ++l) t[l] = x[j + l];
+		 for (std::size_t l = 0; l < k; ++l) {
+		  y[j + l] = f(t[l]);
+		 }
+		 for (std::size_t l = 0; l < k; ++l) {
+		  if (not c(t[l])) y[j + l] = g(t[l]);
+		 }
+		}
+	}
+
+	/// Applies a lane kernel to each x, which covers any argument
+	template <typename num_t, typename lane>
+	numeric_lane void transform(std::span<const num_t> x, std::span<num_t> y, lane f)
+	{
+		assert(x.size() <= y.size());
+		const std::size_t n = x.size();
+		for (std::size_t i = 0; i < n; ++i) {
+		 y[i] = f(x[i]);
+		}
+	}
+
+	/// Applies a lane kernel to each pair of x and p, then the scalar function where the kernel does not cover x, which may be done in place
+	template <typename num_t, typename lane, typename covers, typename scalar>
+	numeric_lane void transform(std::span<const num_t> x, std::span<const num_t> p, std::span<num_t> y, lane f, covers c, scalar g)
+	{
+		assert(x.size() <= p.size() and x.size() <= y.size());
+		constexpr std::size_t m = transform_block;
+		const std::size_t n = x.size();
+		for (std::size_t j = 0; j < n; j += m) {
+		 const std::size_t k = std::min(m, n - j);
+		 num_t t[m], q[m];
+		 for (std::size_t l = 0; l < k; ++l) {
+		  t[l] = x[j + l];
+		  q[l] = p[j + l];
+		 }
+		 for (std::size_t l = 0; l < k; ++l) {
+		  y[j + l] = f(t[l], q[l]);
+		 }
+		 for (std::size_t l = 0; l < k; ++l) {
+		  if (not c(t[l])) y[j + l] = g(t[l], q[l]);
+		 }
+		}
+	}
+
+	/// Applies a lane kernel to each pair of x and p, which covers any arguments
+	template <typename num_t, typename lane>
+	numeric_lane void transform(std::span<const num_t> x, std::span<const num_t> p, std::span<num_t> y, lane f)
+	{
+		assert(x.size() <= p.size() and x.size() <= y.size());
+		const std::size_t n = x.size();
+		for (std::size_t i = 0; i < n; ++i) {
+		 y[i] = f(x[i], p[i]);
+		}
+	}
+
+	/// Applies Borwein's series for zeta to blocks of x, a term at a time across each block
+	template <typename num_t> numeric_lane void zeta_transform(std::span<const num_t> x, std::span<num_t> y)
+	{
+		assert(x.size() <= y.size());
+		constexpr std::size_t m = 64;
+		const std::size_t n = x.size();
+		for (std::size_t j = 0; j < n; j += m) {
+		 const std::size_t b = std::min(m, n - j);
+		 num_t s[m];
+		 for (std::size_t i = 0; i < b; ++i) {
+		  s[i] = zeta_table<num_t>[0];
+		 }
+		 for (unsigned k = 1; k < zeta_terms<num_t>; ++k) {
+		  const num_t c = zeta_table<num_t>[k], l = zeta_logs<num_t>[k];
+		  for (std::size_t i = 0; i < b; ++i) {
+		   s[i] += c*exp_lane(-x[j + i]*l);
+		  }
+		 }
+		 for (std::size_t i = 0; i < b; ++i) {
+		  y[j + i] = s[i]/-expm1_lane((1 - x[j + i])*num_t(ln2));
+		 }
+		}
+	}
+
+	/// Applies the binary gcd to blocks of pairs a branch free step at a time, then finishes each pair with f(m, n, gcd)
+	template <typename uint_t, typename finish>
+	numeric_lane void gcd_transform(std::span<const uint_t> m, std::span<const uint_t> n, std::span<uint_t> y, finish f)
+	{
+		assert(m.size() <= n.size() and m.size() <= y.size());
+		constexpr std::size_t b = 16;
+		const std::size_t size = m.size();
+		for (std::size_t j = 0; j < size; j += b) {
+		 const std::size_t c = std::min(b, size - j);
+		 // An odd u and a v whose gcd is the odd part of the whole, which has 2^k besides
+		 uint_t p[b], q[b], u[b], v[b];
+		 int k[b];
+		 for (std::size_t i = 0; i < b; ++i) {
+		  p[i] = i < c ? m[j + i] : 0;
+		  q[i] = i < c ? n[j + i] : 0;
+		  const uint_t r = p[i] ? p[i] : q[i];
+		  k[i] = r ? std::countr_zero(static_cast<uint_t>(p[i] | q[i])) : 0;
+		  u[i] = r ? r >> std::countr_zero(r) : 0;
+		  v[i] = p[i] ? q[i] : 0;
+		 }
+		 // Halve an even v, or else replace the larger by the difference, until every v is gone
+		 for (uint_t any = 1; any;) {
+		  for (unsigned s = 0; s < 8; ++s) {
+		   for (std::size_t i = 0; i < b; ++i) {
+		    const uint_t lo = std::min(u[i], v[i]), hi = std::max(u[i], v[i]);
+		    const bool odd = v[i] & 1;
+		    u[i] = odd ? lo : u[i];
+		    v[i] = odd ? hi - lo : v[i] >> 1;
+		   }
+		  }
+		  any = 0;
+		  for (std::size_t i = 0; i < b; ++i) {
+		   any |= v[i];
+		  }
+		 }
+		 for (std::size_t i = 0; i < c; ++i) {
+		  y[j + i] = f(p[i], q[i], static_cast<uint_t>(u[i] << k[i]));
+		 }
+		}
+	}
+
+	numeric_clones inline void gcd(std::span<const std::uint32_t> m, std::span<const std::uint32_t> n, std::span<std::uint32_t> y)
+	{
+		gcd_transform(m, n, y, [](std::uint32_t, std::uint32_t, std::uint32_t g) { return g; });
+	}
+
+	numeric_clones inline void gcd(std::span<const std::uint64_t> m, std::span<const std::uint64_t> n, std::span<std::uint64_t> y)
+	{
+		gcd_transform(m, n, y, [](std::uint64_t, std::uint64_t, std::uint64_t g) { return g; });
+	}
+
+	numeric_clones inline void lcm(std::span<const std::uint32_t> m, std::span<const std::uint32_t> n, std::span<std::uint32_t> y)
+	{
+		gcd_transform(m, n, y, [](std::uint32_t a, std::uint32_t b, std::uint32_t g) { return g ? a/g*b : 0; });
+	}
+
+	numeric_clones inline void lcm(std::span<const std::uint64_t> m, std::span<const std::uint64_t> n, std::span<std::uint64_t> y)
+	{
+		gcd_transform(m, n, y, [](std::uint64_t a, std::uint64_t b, std::uint64_t g) { return g ? a/g*b : 0; });
+	}
+
+	template <typename policy = precise> numeric_clones inline void exp(std::span<const float> x, std::span<float> y)
+	{
+		transform(x, y, exp_lane<float, policy>);
+	}
+
+	template <typename policy = precise> numeric_clones inline void exp(std::span<const double> x, std::span<double> y)
+	{
+		transform(x, y, exp_lane<double, policy>);
+	}
+
+	numeric_clones inline void expm1(std::span<const float> x, std::span<float> y)
+	{
+		transform(x, y, expm1_lane<float>);
+	}
+
+	numeric_clones inline void expm1(std::span<const double> x, std::span<double> y)
+	{
+		transform(x, y, expm1_lane<double>);
+	}
+
+	numeric_clones inline void exp2(std::span<const float> x, std::span<float> y)
+	{
+		transform(x, y, exp2_lane<float>);
+	}
+
+	numeric_clones inline void exp2(std::span<const double> x, std::span<double> y)
+	{
+		transform(x, y, exp2_lane<double>);
+	}
+
+	template <typename policy = precise> numeric_clones inline void ln(std::span<const float> x, std::span<float> y)
+	{
+		transform(x, y, ln_lane<float, policy>, ln_covers<float>, ln<float, policy>);
+	}
+
+	template <typename policy = precise> numeric_clones inline void ln(std::span<const double> x, std::span<double> y)
+	{
+		transform(x, y, ln_lane<double, policy>, ln_covers<double>, ln<double, policy>);
+	}
+
+	numeric_clones inline void log2(std::span<const float> x, std::span<float> y)
+	{
+		transform(x, y, [](float a) { return ln_lane(a)*float(log2e); }, ln_covers<float>, log2<float>);
+	}
+
+	numeric_clones inline void log2(std::span<const double> x, std::span<double> y)
+	{
+		transform(x, y, [](double a) { return ln_lane(a)*double(log2e); }, ln_covers<double>, log2<double>);
+	}
+
+	numeric_clones inline void log10(std::span<const float> x, std::span<float> y)
+	{
+		transform(x, y, [](float a) { return ln_lane(a)*float(log10e); }, ln_covers<float>, log10<float>);
+	}
+
+	numeric_clones inline void log10(std::span<const double> x, std::span<double> y)
+	{
+		transform(x, y, [](double a) { return ln_lane(a)*double(log10e); }, ln_covers<double>, log10<double>);
+	}
+
+	numeric_clones inline void pow(std::span<const float> x, float p, std::span<float> y)
+	{
+		transform(x, y, [p](float a) { return pow_lane(a, p); }, ln_covers<float>, [p](float a) { return pow(a, p); });
+	}
+
+	numeric_clones inline void pow(std::span<const double> x, double p, std::span<double> y)
+	{
+		transform(x, y, [p](double a) { return pow_lane(a, p); }, ln_covers<double>, [p](double a) { return pow(a, p); });
+	}
+
+	numeric_clones inline void pow(std::span<const float> x, std::span<const float> p, std::span<float> y)
+	{
+		transform(x, p, y, pow_lane<float>, ln_covers<float>, pow<float>);
+	}
+
+	numeric_clones inline void pow(std::span<const double> x, std::span<const double> p, std::span<double> y)
+	{
+		transform(x, p, y, pow_lane<double>, ln_covers<double>, pow<double>);
+	}
+
+	template <typename policy = precise> numeric_clones inline void sin(std::span<const float> x, std::span<float> y)
+	{
+		transform(x, y, [](float a) { return sin_lane<float, policy>(a, 0); }, trig_covers<float>, sin<float, policy>);
+	}
+
+	template <typename policy = precise> numeric_clones inline void sin(std::span<const double> x, std::span<double> y)
+	{
+		transform(x, y, [](double a) { return sin_lane<double, policy>(a, 0); }, trig_covers<double>, sin<double, policy>);
+	}
+
+	template <typename policy = precise> numeric_clones inline void cos(std::span<const float> x, std::span<float> y)
+	{
+		transform(x, y, [](float a) { return sin_lane<float, policy>(a, 1); }, trig_covers<float>, cos<float, policy>);
+	}
+
+	template <typename policy = precise> numeric_clones inline void cos(std::span<const double> x, std::span<double> y)
+	{
+		transform(x, y, [](double a) { return sin_lane<double, policy>(a, 1); }, trig_covers<double>, cos<double, policy>);
+	}
+
+	numeric_clones inline void tan(std::span<const float> x, std::span<float> y)
+	{
+		transform(x, y, tan_lane<float>, trig_covers<float>, tan<float>);
+	}
+
+	numeric_clones inline void tan(std::span<const double> x, std::span<double> y)
+	{
+		transform(x, y, tan_lane<double>, trig_covers<double>, tan<double>);
+	}
+
+	numeric_clones inline void sinh(std::span<const float> x, std::span<float> y)
+	{
+		transform(x, y, sinh_lane<float>);
+	}
+
+	numeric_clones inline void sinh(std::span<const double> x, std::span<double> y)
+	{
+		transform(x, y, sinh_lane<double>);
+	}
+
+	numeric_clones inline void cosh(std::span<const float> x, std::span<float> y)
+	{
+		transform(x, y, cosh_lane<float>);
+	}
+
+	numeric_clones inline void cosh(std::span<const double> x, std::span<double> y)
+	{
+		transform(x, y, cosh_lane<double>);
+	}
+
+	template <typename policy = precise> numeric_clones inline void tanh(std::span<const float> x, std::span<float> y)
+	{
+		transform(x, y, tanh_lane<float, policy>);
+	}
+
+	template <typename policy = precise> numeric_clones inline void tanh(std::span<const double> x, std::span<double> y)
+	{
+		transform(x, y, tanh_lane<double, policy>);
+	}
+
+	template <typename policy = precise> numeric_clones inline void atan(std::span<const float> x, std::span<float> y)
+	{
+		transform(x, y, atan_lane<float, policy>);
+	}
+
+	template <typename policy = precise> numeric_clones inline void atan(std::span<const double> x, std::span<double> y)
+	{
+		transform(x, y, atan_lane<double, policy>);
+	}
+
+	template <typename policy = precise> numeric_clones inline void atan2(std::span<const float> y, std::span<const float> x, std::span<float> z)
+	{
+		transform(y, x, z, atan2_lane<float, policy>);
+	}
+
+	template <typename policy = precise> numeric_clones inline void atan2(std::span<const double> y, std::span<const double> x, std::span<double> z)
+	{
+		transform(y, x, z, atan2_lane<double, policy>);
+	}
+
+	template <typename policy = precise> numeric_clones inline void asin(std::span<const float> x, std::span<float> y)
+	{
+		transform(x, y, asin_lane<float, policy>);
+	}
+
+	template <typename policy = precise> numeric_clones inline void asin(std::span<const double> x, std::span<double> y)
+	{
+		transform(x, y, asin_lane<double, policy>);
+	}
+
+	template <typename policy = precise> numeric_clones inline void acos(std::span<const float> x, std::span<float> y)
+	{
+		transform(x, y, acos_lane<float, policy>);
+	}
+
+	template <typename policy = precise> numeric_clones inline void acos(std::span<const double> x, std::span<double> y)
+	{
+		transform(x, y, acos_lane<double, policy>);
+	}
+
+	numeric_clones inline void asinh(std::span<const float> x, std::span<float> y)
+	{
+		transform(x, y, asinh_lane<float>, asinh_covers<float>, asinh<float>);
+	}
+
+	numeric_clones inline void asinh(std::span<const double> x, std::span<double> y)
+	{
+		transform(x, y, asinh_lane<double>, asinh_covers<double>, asinh<double>);
+	}
+
+	numeric_clones inline void acosh(std::span<const float> x, std::span<float> y)
+	{
+		transform(x, y, acosh_lane<float>, acosh_covers<float>, acosh<float>);
+	}
+
+	numeric_clones inline void acosh(std::span<const double> x, std::span<double> y)
+	{
+		transform(x, y, acosh_lane<double>, acosh_covers<double>, acosh<double>);
+	}
+
+	numeric_clones inline void atanh(std::span<const float> x, std::span<float> y)
+	{
+		transform(x, y, atanh_lane<float>, atanh_covers<float>, atanh<float>);
+	}
+
+	numeric_clones inline void atanh(std::span<const double> x, std::span<double> y)
+	{
+		transform(x, y, atanh_lane<double>, atanh_covers<double>, atanh<double>);
+	}
+
+	numeric_clones inline void zeta(std::span<const float> x, std::span<float> y)
+	{
+		zeta_transform(x, y);
+	}
+
+	numeric_clones inline void zeta(std::span<const double> x, std::span<double> y)
+	{
+		zeta_transform(x, y);
+	}
+
+	numeric_clones inline void lgamma(std::span<const float> x, std::span<float> y)
+	{
+		transform(x, y, lgamma_lane<float>, lgamma_covers<float>, lgamma<float>);
+	}
+
+	numeric_clones inline void lgamma(std::span<const double> x, std::span<double> y)
+	{
+		transform(x, y, lgamma_lane<double>, lgamma_covers<double>, lgamma<double>);
+	}
+
+	numeric_clones inline void tgamma(std::span<const float> x, std::span<float> y)
+	{
+		transform(x, y, tgamma_lane<float>, tgamma_covers<float>, tgamma<float>);
+	}
+
+	numeric_clones inline void tgamma(std::span<const double> x, std::span<double> y)
+	{
+		transform(x, y, tgamma_lane<double>, tgamma_covers<double>, tgamma<double>);
+	}
+
+	template <typename policy = precise> numeric_clones inline void erf(std::span<const float> x, std::span<float> y)
+	{
+		transform(x, y, erf_lane<float, policy>, erf_covers<float>, erf<float, policy>);
+	}
+
+	template <typename policy = precise> numeric_clones inline void erf(std::span<const double> x, std::span<double> y)
+	{
+		transform(x, y, erf_lane<double, policy>, erf_covers<double>, erf<double, policy>);
+	}
+
+	numeric_clones inline void erfc(std::span<const float> x, std::span<float> y)
+	{
+		transform(x, y, erfc_lane<float>, erf_covers<float>, erfc<float>);
+	}
+
+	numeric_clones inline void erfc(std::span<const double> x, std::span<double> y)
+	{
+		transform(x, y, erfc_lane<double>, erf_covers<double>, erfc<double>);
+	}
+
+	numeric_clones inline void erfcx(std::span<const float> x, std::span<float> y)
+	{
+		transform(x, y, erfcx_lane<float>, erfcx_covers<float>, erfcx<float>);
+	}
+
+	numeric_clones inline void erfcx(std::span<const double> x, std::span<double> y)
+	{
+		transform(x, y, erfcx_lane<double>, erfcx_covers<double>, erfcx<double>);
+	}
+
 }; // namespace
 
 #endif // file
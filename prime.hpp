@@ -0,0 +1,250 @@
+#ifndef prime_hpp
+#define prime_hpp
+
+/**
+ * A segmented sieve of Eratosthenes for streaming primes through a range
+ * without holding all of them. Numbers are packed with a wheel of 30, so a
+ * byte stands for 30 consecutive numbers and each of its bits for one of the
+ * 8 residues which have no factor of 2, 3 or 5. A segment of 32 KiB covers
+ * almost a million numbers and sits in the first level of cache while the
+ * multiples of the sieving primes are crossed off it.
+ *
+ * For a prime p each residue class of the wheel holds the multiples p k with
+ * k in one class modulo 30, and these are 30 p apart, so p bytes apart in
+ * the sieve. So each prime crosses off 8 strided runs per segment, and every
+ * segment can be sieved on its own, which is what lets prime_count spread
+ * them over threads.
+ */
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace numeric
+{
+	/// Residues modulo 30 which have no factor 2, 3 or 5, one for each bit of a sieve byte
+	constexpr std::array<unsigned, 8> wheel = { 1, 7, 11, 13, 17, 19, 23, 29 };
+
+	/// Inverses modulo 30 of the wheel residues, so wheel[i]*wheel_inverse[i] = 1 (mod 30)
+	constexpr std::array<unsigned, 8> wheel_inverse = { 1, 13, 11, 7, 23, 19, 17, 29 };
+
+	/// Class modulo 30 of the cofactors k of a prime of residue wheel[j] for which p k has residue wheel[i]
+	constexpr auto wheel_class = [] {
+		std::array<std::array<unsigned, 8>, 8> c { };
+		for (unsigned j = 0; j < 8; ++j) {
+		 for (unsigned i = 0; i < 8; ++i) c[j][i] = wheel[i]*wheel_inverse[j] % 30;
+		}
+		return c;
+	}();
+
+	/// Position of each residue modulo 30 in the wheel, if it is there
+	constexpr auto wheel_index = [] {
+		std::array<unsigned, 30> n { };
+		for (unsigned i = 0; i < 8; ++i) n[wheel[i]] = i;
+		return n;
+	}();
+
+	/// Bytes in one segment of the sieve, sized for the first level of cache
+	constexpr std::size_t segment_bytes = 1 << 15;
+
+	/// Numbers covered by one segment of the sieve
+	constexpr std::uint64_t segment_span = 30*segment_bytes;
+
+	/// The largest r with r*r <= n
+	inline std::uint64_t isqrt(std::uint64_t n)
+	{
+		auto r = static_cast<std::uint64_t>(std::sqrt(static_cast<double>(n)));
+		while (r and n/r < r) --r;
+		while ((r + 1) <= n/(r + 1)) ++r;
+		return r;
+	}
+
+	/// The primes from 7 up to n by a plain sieve, which cross off the segments
+	inline std::vector<std::uint32_t> sieving_primes(std::uint32_t n)
+	{
+		std::vector<bool> composite(n + 1);
+		std::vector<std::uint32_t> p;
+		for (std::uint64_t q = 7; q <= n; q += 2) {
+		 if (composite[q] or 0 == q % 3 or 0 == q % 5) continue;
+		 p.push_back(static_cast<std::uint32_t>(q));
+		 for (std::uint64_t m = q*q; m <= n; m += 2*q) composite[m] = true;
+		}
+		return p;
+	}
+
+	/// Sieves the numbers from lo (a multiple of 30) into s, with the sieving primes up to the root of the end
+	inline void sieve_segment(std::uint64_t lo, std::span<std::uint8_t> s, std::span<const std::uint32_t> base)
+	{
+		std::fill(s.begin(), s.end(), 0xFF);
+		const std::uint64_t hi = lo + 30*s.size();
+		for (const std::uint64_t p : base) {
+		 if (hi <= p*p) break;
+		 // Cofactors start at p, so that the smaller ones are left to smaller primes
+		 const std::uint64_t q = std::max(p, (lo + p - 1)/p);
+		 const auto &c = wheel_class[wheel_index[p % 30]];
+		 const unsigned m = 30 - q % 30;
+		 for (unsigned i = 0; i < 8; ++i) {
+		  // The cofactor k of p for residue i is in the class wheel[i]/p modulo 30
+		  const std::uint64_t k = q + (c[i] + m) % 30;
+		  const auto bit = static_cast<std::uint8_t>(~(1u << i));
+		  for (std::uint64_t j = (p*k - lo)/30; j < s.size(); j += p) s[j] &= bit;
+		 }
+		}
+		// One is not prime
+		if (0 == lo) s[0] &= 0xFE;
+	}
+
+	/// The primes in [lo, hi) as an input range which sieves one segment at a time
+	class primes
+	{
+		std::uint64_t lo, hi;
+
+	public:
+
+		class iterator
+		{
+			std::vector<std::uint32_t> base;
+			std::vector<std::uint8_t> s;
+			std::uint64_t lo = 0, hi = 0, at = 0, p = 0, top = 0;
+			std::size_t byte = 0;
+			unsigned bits = 0;
+
+			void next_segment()
+			{
+				const std::uint64_t end = at + segment_span;
+				const std::uint64_t root = isqrt(std::min(end, hi) - 1);
+				// Grow the sieving primes as the segments rise
+				if (top < root) {
+				 top = std::min<std::uint64_t>(std::max(root, 2*top), std::numeric_limits<std::uint32_t>::max());
+				 base = sieving_primes(static_cast<std::uint32_t>(top));
+				}
+				sieve_segment(at, s, base);
+				byte = 0;
+				bits = s[0];
+			}
+
+			void advance()
+			{
+				// The primes of the wheel itself are not in the sieve
+				for (const std::uint64_t w : { 2, 3, 5 }) {
+				 if (p < w) {
+				  p = w;
+				  if (lo <= p and p < hi) return;
+				 }
+				}
+				while (p < hi) {
+				 while (not bits) {
+				  if (++byte < s.size()) {
+				   bits = s[byte];
+				   continue;
+				  }
+				  if (hi - at <= segment_span) {
+				   p = hi;
+				   return;
+				  }
+				  at += segment_span;
+				  next_segment();
+				 }
+				 const auto i = std::countr_zero(bits);
+				 bits &= bits - 1;
+				 p = at + 30*byte + wheel[i];
+				 if (lo <= p) break;
+				}
+				if (hi < p) p = hi;
+			}
+
+		public:
+
+			using iterator_category = std::input_iterator_tag;
+			using difference_type = std::ptrdiff_t;
+			using value_type = std::uint64_t;
+
+			iterator() = default;
+
+			iterator(std::uint64_t lo, std::uint64_t hi)
+			: s(segment_bytes), lo(lo), hi(hi), at(lo/30*30)
+			{
+				if (lo < hi) next_segment();
+				else p = hi;
+				advance();
+			}
+
+			std::uint64_t operator*() const
+			{
+				return p;
+			}
+
+			iterator &operator++()
+			{
+				advance();
+				return *this;
+			}
+
+			void operator++(int)
+			{
+				advance();
+			}
+
+			bool operator==(std::default_sentinel_t) const
+			{
+				return hi <= p;
+			}
+		};
+
+		primes(std::uint64_t lo, std::uint64_t hi) : lo(lo), hi(hi)
+		{ }
+
+		explicit primes(std::uint64_t hi = std::numeric_limits<std::uint64_t>::max()) : primes(0, hi)
+		{ }
+
+		iterator begin() const
+		{
+			return iterator(lo, hi);
+		}
+
+		std::default_sentinel_t end() const
+		{
+			return std::default_sentinel;
+		}
+	};
+
+	/// The number of primes up to and including n, sieving the segments on the given number of threads
+	inline std::uint64_t prime_count(std::uint64_t n, unsigned threads = 1)
+	{
+		if (n < 7) return (2 <= n) + (3 <= n) + (5 <= n);
+		const auto base = sieving_primes(static_cast<std::uint32_t>(isqrt(n)));
+		const std::uint64_t segments = n/segment_span + 1;
+		threads = static_cast<unsigned>(std::clamp<std::uint64_t>(threads, 1, segments));
+		std::vector<std::uint64_t> counts(threads);
+		auto work = [&](unsigned t) {
+			std::vector<std::uint8_t> s(segment_bytes);
+			std::uint64_t c = 0;
+			for (std::uint64_t k = t; k < segments; k += threads) {
+			 const std::uint64_t lo = k*segment_span;
+			 sieve_segment(lo, s, base);
+			 // Only the bytes below n + 1, and of the last of them only the bits up to n
+			 const std::size_t b = std::min<std::uint64_t>(segment_bytes, (n - lo)/30 + 1);
+			 for (std::size_t j = 0; j + 1 < b; ++j) c += std::popcount(s[j]);
+			 for (unsigned i = 0; i < 8; ++i) c += (s[b - 1] >> i & 1) and lo + 30*(b - 1) + wheel[i] <= n;
+			}
+			counts[t] = c;
+		};
+		std::vector<std::thread> pool;
+		for (unsigned t = 1; t < threads; ++t) pool.emplace_back(work, t);
+		work(0);
+		for (auto &t : pool) t.join();
+		std::uint64_t c = 3;
+		for (const auto k : counts) c += k;
+		return c;
+	}
+
+}; // namespace
+
+#endif // file
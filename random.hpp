@@ -0,0 +1,116 @@
+#ifndef random_hpp
+#define random_hpp
+
+/**
+ * Counter based random numbers. Philox4x32-10 of Salmon et al., "Parallel
+ * random numbers: as easy as 1, 2, 3", is a keyed bijection on 128 bit
+ * counters, ten rounds of two 32 bit multiplications whose high and low
+ * halves are mixed with the key. Its output for a counter depends on that
+ * counter alone, so there is no state to carry from one number to the next.
+ * Any number of the sequence can be had directly, a range of them can be
+ * handed to each thread, and a block of them worked out one lane each, all
+ * with the same numbers as one thread would have drawn.
+ *
+ * The counter here is the index of a variate in two words, a stream in the
+ * third and a round in the fourth, so that each variate has rounds of its
+ * own to draw on however many a rejection method takes. The seed is the key.
+ * Variates are then a function of the seed, the stream and their index, and
+ * so reproducible whatever the order or the threads they were drawn in.
+ */
+
+#include <array>
+#include <bit>
+#include <cstdint>
+
+namespace numeric
+{
+	/// The Philox4x32-10 generator of one seed and stream, mapping an index and round to four words
+	class philox
+	{
+	public:
+
+		using block = std::array<std::uint32_t, 4>;
+		using key = std::array<std::uint32_t, 2>;
+
+		/// The ten rounds of Philox4x32 on counter c with key k
+		static constexpr block bijection(block c, key k)
+		{
+			for (int n = 0; n < 10; ++n) {
+			 const std::uint64_t a = std::uint64_t(0xD2511F53)*c[0];
+			 const std::uint64_t b = std::uint64_t(0xCD9E8D57)*c[2];
+			 c = {
+			  std::uint32_t(b >> 32) ^ c[1] ^ k[0], std::uint32_t(b),
+			  std::uint32_t(a >> 32) ^ c[3] ^ k[1], std::uint32_t(a)
+			 };
+			 // The Weyl sequence of the key, by the golden ratio and sqrt(3) - 1
+			 k[0] += 0x9E3779B9;
+			 k[1] += 0xBB67AE85;
+			}
+			return c;
+		}
+
+		constexpr philox(std::uint64_t seed, std::uint32_t stream = 0)
+		: k { std::uint32_t(seed), std::uint32_t(seed >> 32) }, s(stream)
+		{ }
+
+		/// Another stream of the same seed, whose numbers are independent of these
+		constexpr philox split(std::uint32_t stream) const
+		{
+			philox g = *this;
+			g.s = stream;
+			return g;
+		}
+
+		/// The block of round r of index i
+		constexpr block operator()(std::uint64_t i, std::uint32_t r = 0) const
+		{
+			return bijection({ std::uint32_t(i), std::uint32_t(i >> 32), s, r }, k);
+		}
+
+	private:
+
+		key k;
+		std::uint32_t s;
+	};
+
+	/// The blocks one variate draws on, its rounds in turn, with parts that keep apart those of variates combined into one
+	class philox_draws
+	{
+		const philox &g;
+		std::uint64_t i;
+		std::uint32_t r;
+
+	public:
+
+		/// Rounds of part 0 through 255 are 2^24 apart
+		constexpr philox_draws(const philox &g, std::uint64_t i, std::uint32_t part = 0)
+		: g(g), i(i), r(part << 24)
+		{ }
+
+		constexpr philox::block operator()()
+		{
+			return g(i, r++);
+		}
+	};
+
+	/// Uniform in [0, 1) from the leading bits of hi and lo, as many as the mantissa of num_t holds
+	template <typename num_t> constexpr num_t uniform(std::uint32_t hi, std::uint32_t lo)
+	{
+		// Filling the mantissa of a number in [1, 2) and taking 1 off needs no conversion of integers, so it vectorizes
+		if constexpr (sizeof(num_t) == sizeof(std::uint32_t)) {
+			return std::bit_cast<num_t>(std::uint32_t(0x3F800000) | hi >> 9) - 1;
+		} else {
+			const std::uint64_t w = std::uint64_t(hi) << 32 | lo;
+			return num_t(std::bit_cast<double>(std::uint64_t(0x3FF0000000000000) | w >> 12) - 1);
+		}
+	}
+
+	/// Uniform in (0, 1], for the logarithms of rejection methods
+	template <typename num_t> constexpr num_t uniform_open(std::uint32_t hi, std::uint32_t lo)
+	{
+		return 1 - uniform<num_t>(hi, lo);
+	}
+
+}; // namespace
+
+#endif // file
@@ -0,0 +1,313 @@
+#ifndef series_hpp
+#define series_hpp
+
+/**
+ * Most of the functions in numeric.hpp are a series or a continued fraction
+ * which is evaluated term by term until the terms no longer matter. Rather
+ * than each function hand rolling that loop, here is the loop once, taking
+ * a generator of the terms. The summation can be compensated (Kahan's or
+ * Neumaier's) for series whose terms alternate or cancel, and the stopping
+ * rule is a relative tolerance with a cap on the number of iterations.
+ *
+ * Each evaluation can also count its iterations into a histogram, so that
+ * one can find out which inputs are the expensive ones. The counts are kept
+ * with relaxed atomics so that a histogram may be shared between threads.
+ * A histogram is switched on for the current thread by holding a monitor.
+ * Evaluations in constant expressions are not counted.
+ *
+ * Series which converge slowly can be summed through an accelerator in the
+ * place of the accumulator. These keep the partial sums and extrapolate to
+ * the limit: Wynn's epsilon algorithm for linear and alternating series,
+ * Levin's u transform for logarithmic ones, and the method of Cohen, Villegas
+ * and Zagier for alternating series of totally monotone terms. Often they
+ * find in tens of terms what plain summation would take thousands to find.
+ */
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace numeric
+{
+	/// Half of the unit roundoff, the size below which a term no longer counts
+	template <typename num_t> constexpr long double epsilon = std::numeric_limits<num_t>::epsilon()/2.0L;
+
+	/// Iterations after which a series or continued fraction stops trying to converge
+	constexpr unsigned max_iterations = 1 << 16;
+
+	/// Stands in for a zero denominator in Lentz's method
+	template <typename num_t> constexpr num_t tiny = std::numeric_limits<num_t>::min()*16;
+
+	/// The magnitude of x
+	template <typename num_t> constexpr num_t abs(num_t x)
+	{
+		return x < 0 ? -x : x;
+	}
+
+	/// Counts of evaluations by the bit length of their number of iterations
+	struct histogram
+	{
+		std::array<std::atomic<std::uint64_t>, 33> bins { };
+		std::atomic<std::uint64_t> calls { 0 }, iterations { 0 };
+		std::atomic<unsigned> most { 0 };
+
+		void record(unsigned n)
+		{
+			constexpr auto relaxed = std::memory_order_relaxed;
+			bins[std::bit_width(n)].fetch_add(1, relaxed);
+			calls.fetch_add(1, relaxed);
+			iterations.fetch_add(n, relaxed);
+			unsigned m = most.load(relaxed);
+			while (m < n and not most.compare_exchange_weak(m, n, relaxed));
+		}
+
+		/// Evaluations that took from 2^(k - 1) up to 2^k - 1 iterations
+		std::uint64_t operator[](unsigned k) const
+		{
+			return bins[k].load(std::memory_order_relaxed);
+		}
+	};
+
+	/// The histogram that evaluations on this thread record into, if any
+	inline thread_local histogram *telemetry = nullptr;
+
+	/// Records the evaluations made on this thread into a histogram while in scope
+	class monitor
+	{
+		histogram *last;
+
+	public:
+
+		explicit monitor(histogram &h) : last(telemetry)
+		{
+			telemetry = &h;
+		}
+
+		~monitor()
+		{
+			telemetry = last;
+		}
+
+		monitor(const monitor &) = delete;
+		monitor &operator=(const monitor &) = delete;
+	};
+
+	/// Counts the iterations of one evaluation if this thread is monitored
+	constexpr void record(unsigned n)
+	{
+		if (not std::is_constant_evaluated() and telemetry) telemetry->record(n);
+	}
+
+	/// Plain summation
+	template <typename num_t> struct naive
+	{
+		num_t s = 0;
+
+		constexpr naive &operator+=(const num_t &t)
+		{
+			s += t;
+			return *this;
+		}
+
+		constexpr operator num_t() const
+		{
+			return s;
+		}
+	};
+
+	/// Kahan's compensated summation, which carries the rounding error of each addition
+	template <typename num_t> struct kahan
+	{
+		num_t s = 0, c = 0;
+
+		constexpr kahan &operator+=(const num_t &t)
+		{
+			const num_t y = t - c;
+			const num_t u = s + y;
+			c = (u - s) - y;
+			s = u;
+			return *this;
+		}
+
+		constexpr operator num_t() const
+		{
+			return s;
+		}
+	};
+
+	/// Neumaier's variant of Kahan's summation, which also holds when a term outgrows the sum
+	template <typename num_t> struct neumaier
+	{
+		num_t s = 0, c = 0;
+
+		constexpr neumaier &operator+=(const num_t &t)
+		{
+			const num_t u = s + t;
+			c += abs(t) <= abs(s) ? (s - u) + t : (t - u) + s;
+			s = u;
+			return *this;
+		}
+
+		constexpr operator num_t() const
+		{
+			return s + c;
+		}
+	};
+
+	/// Wynn's epsilon algorithm on the partial sums, for linear and alternating convergence
+	template <typename num_t> struct wynn
+	{
+		std::vector<num_t> e;
+		num_t s = 0, v = 0;
+
+		constexpr wynn &operator+=(const num_t &t)
+		{
+			constexpr num_t big = std::numeric_limits<num_t>::max();
+			constexpr num_t small = std::numeric_limits<num_t>::min();
+			// Walk up the rhombus rule, keeping only the latest diagonal
+			s += t;
+			e.push_back(s);
+			num_t u = 0;
+			for (std::size_t j = e.size() - 1; j > 0; --j) {
+			 const num_t w = u;
+			 u = e[j - 1];
+			 const num_t d = e[j] - u;
+			 e[j - 1] = abs(d) <= small ? big : w + 1/d;
+			}
+			const num_t r = e.size() & 1 ? e[0] : e[1];
+			if (abs(r) < big/100) v = r;
+			return *this;
+		}
+
+		constexpr operator num_t() const
+		{
+			return v;
+		}
+	};
+
+	/// Levin's u transform on the partial sums, for logarithmic convergence, which loses precision after some tens of terms
+	template <typename num_t> struct levin
+	{
+		std::vector<num_t> p, q;
+		num_t s = 0, v = 0;
+
+		constexpr levin &operator+=(const num_t &t)
+		{
+			constexpr num_t small = std::numeric_limits<num_t>::min();
+			// Remainder estimate (n + 1)t for the u transform, with beta = 1
+			s += t;
+			if (0 == t) {
+			 v = s;
+			 return *this;
+			}
+			const num_t n = p.size();
+			num_t r = 1/(n + 1);
+			q.push_back(r/((n + 1)*t));
+			p.push_back(s*q.back());
+			const num_t f = n*r;
+			for (std::size_t j = 1, k = p.size() - 1; j <= k; ++j) {
+			 const num_t g = (n - j + 1)*r;
+			 p[k - j] = p[k - j + 1] - g*p[k - j];
+			 q[k - j] = q[k - j + 1] - g*q[k - j];
+			 r *= f;
+			}
+			if (small < abs(q[0])) v = p[0]/q[0];
+			return *this;
+		}
+
+		constexpr operator num_t() const
+		{
+			return v;
+		}
+	};
+
+	/// Terms needed by the Cohen, Villegas and Zagier method, whose error falls as (3 + sqrt 8)^-n
+	constexpr unsigned cvz_terms(long double tol)
+	{
+		unsigned n = 0;
+		for (long double r = 2; tol < r; r /= 5.828427124746190097603L) ++n;
+		return n;
+	}
+
+	/// Cohen, Villegas and Zagier's sum of an alternating series, whose magnitudes are totally monotone
+	template <typename num_t> struct cvz
+	{
+		static constexpr unsigned n = cvz_terms(0 < epsilon<num_t> ? epsilon<num_t> : epsilon<long double>);
+
+		num_t b = -1, c, d = 1, s = 0;
+		unsigned k = 0;
+
+		constexpr cvz()
+		{
+			for (unsigned j = 0; j < n; ++j) d *= 5.828427124746190097603L;
+			d = (d + 1/d)/2;
+			c = -d;
+		}
+
+		constexpr cvz &operator+=(const num_t &t)
+		{
+			// Weights are fixed for n terms, so later terms are ignored
+			if (k < n) {
+			 c = b - c;
+			 s += c*(k & 1 ? -t : t);
+			 b *= num_t(k + n)*(num_t(k) - n)/((k + num_t(0.5))*(k + 1));
+			 ++k;
+			}
+			return *this;
+		}
+
+		constexpr operator num_t() const
+		{
+			return s/d;
+		}
+	};
+
+	/// Sums the terms from next() until the sum changes by no more than tol relatively
+	template <typename num_t, template <typename> class accumulator = naive, typename generator>
+	constexpr num_t sum(generator next, num_t tol = epsilon<num_t>, unsigned max = max_iterations)
+	{
+		accumulator<num_t> s;
+		num_t v = 0;
+		unsigned n = 0;
+		while (n < max) {
+		 s += next();
+		 ++n;
+		 const num_t u = s;
+		 if (abs(u - v) <= abs(u)*tol) break;
+		 v = u;
+		}
+		record(n);
+		return s;
+	}
+
+	/// Evaluates b0 + a1/(b1 + a2/(b2 + ...)) by the modified Lentz method, with next() giving each pair (a, b)
+	template <typename num_t, typename generator>
+	constexpr num_t fraction(num_t b0, generator next, num_t tol = epsilon<num_t>, unsigned max = max_iterations)
+	{
+		num_t f = b0 == 0 ? tiny<num_t> : b0;
+		num_t c = f, d = 0;
+		unsigned n = 0;
+		while (n < max) {
+		 const auto [a, b] = next();
+		 ++n;
+		 d = b + a*d;
+		 if (abs(d) < tiny<num_t>) d = tiny<num_t>;
+		 c = b + a/c;
+		 if (abs(c) < tiny<num_t>) c = tiny<num_t>;
+		 d = 1/d;
+		 const num_t r = c*d;
+		 f *= r;
+		 if (abs(r - 1) <= tol) break;
+		}
+		record(n);
+		return f;
+	}
+
+}; // namespace
+
+#endif // file
@@ -9,87 +9,1356 @@
  */
 
 #include "numeric.hpp"
+#include "random.hpp"
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
 
 namespace statistics
 {
+	// As in R, the densities take a flag for their logarithm and the
+	// distribution functions flags for the upper tail and the logarithm.
+	// The logarithms are worked out as such from lgamma and the logarithms
+	// of the factors, without the powers and exponentials of the densities,
+	// so a sum of them for a likelihood does not underflow where each of the
+	// densities would. The logarithm of a tail is that of its prefactor plus
+	// that of the series or fraction over it, and that of the complement of
+	// a tail is log1p of its negation, so neither is rounded to 0 or 1 first.
+
 	// Normal distribution
 
-	template <typename float_t> float_t dnorm(float_t x, float_t mu=0, float_t sigma=1)
+	template <typename float_t> float_t dnorm(float_t x, float_t mu=0, float_t sigma=1, bool log=false)
 	{
 		float_t z = (x -  mu)/sigma;
+		if (log) return -z*z/2 - float_t(numeric::lnsqrt2pi) - numeric::ln(sigma);
 		return numeric::exp(-z*z/2)/numeric::sqrt2pi/sigma;
 	}
 
-	template <typename float_t> float_t pnorm(float_t x, float_t mu=0, float_t sigma=1)
+	template <typename float_t> float_t pnorm(float_t x, float_t mu=0, float_t sigma=1, bool lower=true, bool log=false)
 	{
 		float_t z = (x - mu)/sigma;
-		return (1 + numeric::erf(z/numeric::sqrt2))/2/sigma;
+		// The tail is erfc(t)/2, which for t > 0 is erfcx(t) e^(-t^2)/2, so that its logarithm does not underflow
+		const float_t t = (lower ? -z : z)/float_t(numeric::sqrt2);
+		if (not log) return numeric::erfc(t)/2;
+		if (0 < t) return numeric::ln(numeric::erfcx(t)/2) - t*t;
+		return numeric::log1p(-numeric::erfc(-t)/2);
+	}
+
+	// Quantiles start from an approximation in closed form and take Halley's
+	// steps on the distribution function, whose derivative is the density and
+	// whose second derivative is the density times its logarithmic derivative.
+	// The steps converge cubically so two or three of them are enough. Where
+	// the start is far off in a tail the steps are taken on the logarithm of
+	// the tail instead, which is nearly straight there. Where the upper tail
+	// is the smaller it is solved instead, so that the target is not rounded
+	// against 1. Outside of [0, 1] a quantile is NaN.
+
+	/// Wichura's AS 241 for the normal quantile, good to about 1e-16: q A(r)/B(r) in the centre
+	constexpr std::array<long double, 8> as241_a = {
+		3.3871328727963666080e0L, 1.3314166789178437745e2L, 1.9715909503065514427e3L, 1.3731693765509461125e4L,
+		4.5921953931549871457e4L, 6.7265770927008700853e4L, 3.3430575583588128105e4L, 2.5090809287301226727e3L
+	};
+	constexpr std::array<long double, 8> as241_b = {
+		1.0L, 4.2313330701600911252e1L, 6.8718700749205790830e2L, 5.3941960214247511077e3L,
+		2.1213794301586595867e4L, 3.9307895800092710610e4L, 2.8729085735721942674e4L, 5.2264952788528545610e3L
+	};
+
+	/// C(r)/D(r) in the tails for r = sqrt(-ln p) up to 5
+	constexpr std::array<long double, 8> as241_c = {
+		1.42343711074968357734e0L, 4.63033784615654529590e0L, 5.76949722146069140550e0L, 3.64784832476320460504e0L,
+		1.27045825245236838258e0L, 2.41780725177450611770e-1L, 2.27238449892691845833e-2L, 7.74545014278341407640e-4L
+	};
+	constexpr std::array<long double, 8> as241_d = {
+		1.0L, 2.05319162663775882187e0L, 1.67638483018380384940e0L, 6.89767334985100004550e-1L,
+		1.48103976427480074590e-1L, 1.51986665636164571966e-2L, 5.47593808499534494600e-4L, 1.05075007164441684324e-9L
+	};
+
+	/// E(r)/F(r) in the far tails beyond
+	constexpr std::array<long double, 8> as241_e = {
+		6.65790464350110377720e0L, 5.46378491116411436990e0L, 1.78482653991729133580e0L, 2.96560571828504891230e-1L,
+		2.65321895265761230930e-2L, 1.24266094738807843860e-3L, 2.71155556874348757815e-5L, 2.01033439929228813265e-7L
+	};
+	constexpr std::array<long double, 8> as241_f = {
+		1.0L, 5.99832206555887937690e-1L, 1.36929880922735805310e-1L, 1.48753612908506148525e-2L,
+		7.86869131145613259100e-4L, 1.84631831751005468180e-5L, 1.42151175831644588870e-7L, 2.04426310338993978564e-15L
+	};
+
+	/// The coefficients of AS 241 in the precision of float_t
+	template <typename float_t> constexpr auto as241 = std::array {
+		numeric::table<float_t, 8>([](unsigned k) { return as241_a[k]; }), numeric::table<float_t, 8>([](unsigned k) { return as241_b[k]; }),
+		numeric::table<float_t, 8>([](unsigned k) { return as241_c[k]; }), numeric::table<float_t, 8>([](unsigned k) { return as241_d[k]; }),
+		numeric::table<float_t, 8>([](unsigned k) { return as241_e[k]; }), numeric::table<float_t, 8>([](unsigned k) { return as241_f[k]; })
+	};
+
+	/// Where the centre of AS 241 gives way to the tails, |p - 1/2| = 0.425
+	constexpr long double as241_split = 0.425;
+
+	template <typename float_t> float_t qnorm(float_t p, float_t mu=0, float_t sigma=1)
+	{
+		using limits = std::numeric_limits<float_t>;
+		if (not (0 < p and p < 1)) return 0 == p ? -limits::infinity() : 1 == p ? limits::infinity() : limits::quiet_NaN();
+		const auto &c = as241<float_t>;
+		const float_t q = p - float_t(0.5);
+		// The tail is that of the smaller of p and 1 - p, which is exact above a half
+		const float_t s = q < 0 ? p : 1 - p;
+		float_t z;
+		if (numeric::abs(q) <= float_t(as241_split)) {
+		 const float_t r = float_t(0.180625) - q*q;
+		 z = q*numeric::horner(c[0], r)/numeric::horner(c[1], r);
+		} else {
+		 const float_t r = numeric::sqrt(-numeric::ln(s));
+		 z = r <= 5 ? numeric::horner(c[2], r - float_t(1.6))/numeric::horner(c[3], r - float_t(1.6))
+		            : numeric::horner(c[4], r - 5)/numeric::horner(c[5], r - 5);
+		 z = q < 0 ? -z : z;
+		}
+		if constexpr (not numeric::fits_double<float_t>) {
+		 // Beyond double the approximation is only a start, taken on in the lower tail, where the density has -z for its logarithmic derivative
+		 const float_t tol = 4*float_t(numeric::epsilon<float_t>);
+		 float_t w = -numeric::abs(z);
+		 for (unsigned n = 0; n < 8; ++n) {
+		  const float_t t = (pnorm(w) - s)/dnorm(w);
+		  const float_t u = t/(1 + w*t/2);
+		  w -= u;
+		  if (numeric::abs(u) <= tol*numeric::abs(w)) break;
+		 }
+		 z = q < 0 ? w : -w;
+		}
+		return mu + sigma*z;
 	}
 
 	// Gamma distribution
 
-	template <typename float_t> float_t dgamma(float_t x, float_t a, float_t b)
+	/// The logarithm of x^(a - 1), which is 0 for a = 1 even at x = 0
+	template <typename float_t> float_t log_power(float_t x, float_t a)
 	{
+		return 1 == a ? float_t(0) : (a - 1)*numeric::ln(x);
+	}
+
+	/// The logarithm of the gamma density of shape a and rate b, given lga = lgamma(a)
+	template <typename float_t> float_t gamma_log_density(float_t x, float_t a, float_t b, float_t lga)
+	{
+		if (x < 0) return -std::numeric_limits<float_t>::infinity();
+		return log_power(x, a) + a*numeric::ln(b) - b*x - lga;
+	}
+
+	/// The logarithm of P(a, x), or of Q(a, x) if not lower, given c = gamma_scale(a)
+	template <typename float_t> float_t gamma_log_tail(float_t a, float_t x, float_t c, bool lower)
+	{
+		if (x <= 0) return lower ? -std::numeric_limits<float_t>::infinity() : float_t(0);
+		// Q is worked out whole for small a as in gammaq, since log1p(-P) cancels like 1 - P where P is near 1
+		if (not lower and a < 1 and x < float_t(numeric::gamma_small_bound)) {
+		 const float_t q = numeric::gamma_small_upper(a, x);
+		 if (q < float_t(0.5)) return numeric::ln(q);
+		}
+		// The prefactor is split as in gammap, into c and e^e, so neither cancels for large a
+		const float_t e = numeric::gamma_exponent(a, x);
+		if constexpr (numeric::temme_precise<float_t>) {
+			// Temme's expansion gives the smaller tail over e^e, P below a and Q from it
+			if (numeric::gamma_temme_covers(a, x)) {
+			 const float_t s = numeric::gamma_temme(a, x);
+			 return lower == (x < a) ? e + numeric::ln(s) : numeric::log1p(-numeric::exp(e)*s);
+			}
+		}
+		const float_t f = e + numeric::ln(c);
+		// The series below a + 1 sums P and the fraction above it Q, each with the prefactor e^f taken out
+		if (x < a + 1) {
+		 const float_t s = numeric::gamma_series<float_t>(a, x, 1);
+		 return lower ? f + numeric::ln(s) : numeric::log1p(-numeric::exp(f)*s);
+		}
+		const float_t q = numeric::gamma_fraction<float_t>(a, x, 1);
+		return lower ? numeric::log1p(-numeric::exp(f)*q) : f + numeric::ln(q);
+	}
+
+	template <typename float_t> float_t dgamma(float_t x, float_t a, float_t b, bool log=false)
+	{
+		if (log) return gamma_log_density(x, a, b, numeric::lgamma(a));
 		float_t unity = numeric::pow(b, a)/numeric::tgamma(a);
 		return numeric::pow(x, a - 1)*numeric::exp(-x*b)*unity;
 	}
 
-	template <typename float_t> float_t pgamma(float_t x, float_t a, float_t b)
+	template <typename float_t> float_t pgamma(float_t x, float_t a, float_t b, bool lower=true, bool log=false)
 	{
-		return numeric::igamma(a, x*b)/numeric::tgamma(a);
+		if (log) return gamma_log_tail(a, x*b, numeric::gamma_scale(a), lower);
+		return lower ? numeric::gammap(a, x*b) : numeric::gammaq(a, x*b);
+	}
+
+	/// The quantile of the gamma distribution of shape a and unit rate, given lga = lgamma(a)
+	template <typename float_t> float_t gamma_quantile(float_t p, float_t a, float_t lga)
+	{
+		using limits = std::numeric_limits<float_t>;
+		if (not (0 < p and p < 1)) return 0 == p ? float_t(0) : 1 == p ? limits::infinity() : limits::quiet_NaN();
+		// P(a, x) < x^a/Gamma(a + 1), so the root of that is below the quantile, and close to it in the lower tail
+		const float_t low = numeric::exp((numeric::ln(p) + numeric::ln(a) + lga)/a);
+		float_t x;
+		if (1 < a) {
+		 // Wilson and Hilferty, the cube root of x/a is nearly normal with mean 1 - 1/(9a) and variance 1/(9a)
+		 const float_t v = 1/(9*a);
+		 const float_t w = 1 - v + qnorm(p)*numeric::sqrt(v);
+		 x = std::max<float_t>(low, a*w*w*w);
+		} else {
+		 // Below t the power of the lower tail, above it the exponential of the upper tail
+		 const float_t t = 1 - a*(float_t(0.253) + a*float_t(0.12));
+		 x = p < t ? low : 1 - numeric::log1p(-(p - t)/(1 - t));
+		}
+		const bool lower = p <= float_t(0.5);
+		const float_t target = lower ? p : 1 - p;
+		const float_t tol = 4*float_t(numeric::epsilon<float_t>);
+		for (unsigned n = 0; n < 32; ++n) {
+		 const float_t s = lower ? numeric::gammap(a, x) : numeric::gammaq(a, x);
+		 const float_t d = numeric::exp((a - 1)*numeric::ln(x) - x - lga);
+		 if (0 == s or 0 == d) break;
+		 float_t y;
+		 if (s < target/2 or 2*target < s) {
+		  // Far off, Newton's steps are on ln P against ln x, as the lower tail is a power, or on ln Q against x, as the upper is exponential
+		  const float_t l = numeric::ln(s/target)*s/d;
+		  y = lower ? x*numeric::exp(-l/x) : x + l;
+		 } else {
+		  // Halley's correction is limited so that a poor start cannot throw x past zero
+		  const float_t t = (lower ? s - target : target - s)/d;
+		  y = x - t/(1 - std::min<float_t>(1, t*((a - 1)/x - 1))/2);
+		 }
+		 const float_t u = x - y;
+		 x = 0 < y ? y : x/2;
+		 if (numeric::abs(u) <= tol*x) break;
+		}
+		return x;
+	}
+
+	template <typename float_t> float_t qgamma(float_t p, float_t a, float_t b)
+	{
+		return gamma_quantile(p, a, numeric::lgamma(a))/b;
 	}
 
 	// Exponential distribution
 
-	template <typename float_t> float_t dexp(float_t x, float_t mu=1)
+	template <typename float_t> float_t dexp(float_t x, float_t mu=1, bool log=false)
 	{
+		if (log) return -x/mu - numeric::ln(mu);
 		return numeric::exp(-x/mu)/mu;
 	}
 
-	template <typename float_t> float_t pexp(float_t x, float_t mu=1)
+	template <typename float_t> float_t pexp(float_t x, float_t mu=1, bool lower=true, bool log=false)
 	{
-		return 1 - numeric::exp(-x/mu);
+		// The upper tail is e^(-y) and the lower -expm1(-y), which keeps its digits near 0
+		const float_t y = std::max<float_t>(x, 0)/mu;
+		if (lower) return log ? numeric::ln(-numeric::expm1(-y)) : -numeric::expm1(-y);
+		return log ? -y : numeric::exp(-y);
+	}
+
+	template <typename float_t> float_t qexp(float_t p, float_t mu=1)
+	{
+		if (not (0 <= p and p <= 1)) return std::numeric_limits<float_t>::quiet_NaN();
+		return -mu*numeric::log1p(-p);
 	}
 
 	// Chi-squared distribution
 
-	template <typename float_t> float_t dchisq(float_t x, float_t nu=1)
+	template <typename float_t> float_t dchisq(float_t x, float_t nu=1, bool log=false)
+	{
+		return dgamma(x, nu/2, float_t(0.5), log);
+	}
+
+	template <typename float_t> float_t pchisq(float_t x, float_t nu=1, bool lower=true, bool log=false)
 	{
-		return dgamma(x, nu/2, 0.5);
+		return pgamma(x, nu/2, float_t(0.5), lower, log);
 	}
 
-	template <typename float_t> float_t pchisq(float_t x, float_t nu=1)
+	template <typename float_t> float_t qchisq(float_t p, float_t nu=1)
 	{
-		return pgamma(x, nu/2, 0.5);
+		return qgamma(p, nu/2, float_t(0.5));
 	}
 
 	// Beta distribution
 
-	template <typename float_t> float_t dbeta(float_t x, float_t a, float_t b)
+	/// The logarithm of the beta density, given lb = lbeta(a, b)
+	template <typename float_t> float_t beta_log_density(float_t x, float_t a, float_t b, float_t lb)
 	{
+		if (x < 0 or 1 < x) return -std::numeric_limits<float_t>::infinity();
+		return log_power(x, a) + (1 == b ? float_t(0) : (b - 1)*numeric::log1p(-x)) - lb;
+	}
+
+	/// The logarithm of I_x(a, b), or of its complement if not lower, given c = beta_scale(a, b)
+	template <typename float_t> float_t beta_log_tail(float_t a, float_t b, float_t x, float_t c, bool lower)
+	{
+		using limits = std::numeric_limits<float_t>;
+		if (x <= 0) return lower ? -limits::infinity() : float_t(0);
+		if (1 <= x) return lower ? float_t(0) : -limits::infinity();
+		// The prefactor is split as in betai, so that lbeta does not cancel for large a and b
+		const float_t f = numeric::beta_exponent(a, b, x) + numeric::ln(c);
+		if constexpr (numeric::is_binary<float_t>) {
+			// The expansion gives the smaller tail, the lower below the mean and the upper from it
+			if (numeric::beta_temme_covers(a, b, x)) {
+			 const float_t s = numeric::beta_temme(a, b, x);
+			 return lower == (x*(a + b) <= a) ? f + numeric::ln(s) : numeric::log1p(-numeric::exp(f)*s);
+			}
+		}
+		// As in betai, the fraction is of the lower tail below the mean and of the upper above it
+		const bool below = x*(a + b + 2) < a + 1;
+		const float_t q = below ? numeric::beta_fraction(a, b, x)/a : numeric::beta_fraction(b, a, 1 - x)/b;
+		return lower == below ? f + numeric::ln(q) : numeric::log1p(-numeric::exp(f)*q);
+	}
+
+	template <typename float_t> float_t dbeta(float_t x, float_t a, float_t b, bool log=false)
+	{
+		if (log) return beta_log_density(x, a, b, numeric::lbeta(a, b));
 		return numeric::pow(x, a-1)*numeric::pow(1-x, b-1)/numeric::beta(a,b);
 	}
 
-	template <typename float_t> float_t pbeta(float_t x, float_t a, float_t b)
+	template <typename float_t> float_t pbeta(float_t x, float_t a, float_t b, bool lower=true, bool log=false)
+	{
+		if (log) return beta_log_tail(a, b, x, numeric::beta_scale(a, b), lower);
+		return lower ? numeric::betai(a, b, x) : numeric::betaic(a, b, x);
+	}
+
+	/// Halley's steps from x towards the quantile of the beta distribution, given lb = lbeta(a, b)
+	template <typename float_t> float_t beta_refine(float_t p, float_t a, float_t b, float_t lb, float_t x)
 	{
-		return numeric::ibeta(a, b, x)/numeric::beta(a, b);
+		const float_t tol = 4*float_t(numeric::epsilon<float_t>);
+		for (unsigned n = 0; n < 32; ++n) {
+		 const float_t s = numeric::betai(a, b, x);
+		 const float_t d = numeric::exp((a - 1)*numeric::ln(x) + (b - 1)*numeric::log1p(-x) - lb);
+		 if (0 == s or 0 == d) break;
+		 float_t y;
+		 if (s < p/2 or 2*p < s) {
+		  // Far off, Newton's steps are on ln I against ln x, as the lower tail is a power
+		  y = x*numeric::exp(-numeric::ln(s/p)*s/(x*d));
+		 } else {
+		  // Halley's correction is limited so that a poor start cannot throw x out of (0, 1)
+		  const float_t t = (s - p)/d;
+		  y = x - t/(1 - std::min<float_t>(1, t*((a - 1)/x - (b - 1)/(1 - x)))/2);
+		 }
+		 const float_t u = x - y;
+		 x = y <= 0 ? x/2 : 1 <= y ? (x + 1)/2 : y;
+		 if (numeric::abs(u) <= tol*x) break;
+		}
+		return x;
+	}
+
+	/// The quantile of the beta distribution, given lb = lbeta(a, b)
+	template <typename float_t> float_t beta_quantile(float_t p, float_t a, float_t b, float_t lb)
+	{
+		using limits = std::numeric_limits<float_t>;
+		if (not (0 < p and p < 1)) return 0 == p ? float_t(0) : 1 == p ? float_t(1) : limits::quiet_NaN();
+		float_t x;
+		if (1 <= a and 1 <= b) {
+		 // Abramowitz and Stegun 26.5.22 from the upper normal quantile
+		 const float_t z = -qnorm(p);
+		 const float_t l = (z*z - 3)/6;
+		 const float_t r = 1/(2*a - 1), s = 1/(2*b - 1);
+		 const float_t h = 2/(r + s);
+		 const float_t w = z*numeric::sqrt(h + l)/h - (s - r)*(l + float_t(5)/6 - 2/(3*h));
+		 // With b >= 1, I_x(a, b) < x^a/(a B(a, b)), so the root of that is below the quantile, which the above is not in the far tail
+		 const float_t low = numeric::exp((numeric::ln(a*p) + lb)/a);
+		 x = std::max<float_t>(low, a/(a + b*numeric::exp(2*w)));
+		} else {
+		 // The density near 0 goes as x^(a - 1) and near 1 as (1 - x)^(b - 1), each tail weighed by its mass
+		 const float_t t = numeric::exp(a*numeric::ln(a/(a + b)))/a;
+		 const float_t u = numeric::exp(b*numeric::ln(b/(a + b)))/b;
+		 const float_t w = t + u;
+		 x = p < t/w ? numeric::pow(a*w*p, 1/a) : 1 - numeric::pow(b*w*(1 - p), 1/b);
+		}
+		// Past 1 - p solve the mirror image, I_x(a, b) = 1 - I_(1 - x)(b, a), as then less is lost in 1 - p than in 1 - x
+		if (1 - p < x) return 1 - beta_refine(1 - p, b, a, lb, 1 - x);
+		return beta_refine(p, a, b, lb, x);
+	}
+
+	template <typename float_t> float_t qbeta(float_t p, float_t a, float_t b)
+	{
+		return beta_quantile(p, a, b, numeric::lbeta(a, b));
 	}
 
 	// Fisher distribution
 
-	template <typename float_t> float_t df(float_t x, float_t num, float_t den)
+	/// The logarithm of the Fisher density, given lb = lbeta(num/2, den/2)
+	template <typename float_t> float_t fisher_log_density(float_t x, float_t num, float_t den, float_t lb)
+	{
+		if (x < 0) return -std::numeric_limits<float_t>::infinity();
+		// (num/den)^(num/2) x^(num/2 - 1) (1 + num x/den)^(-(num + den)/2)/B(num/2, den/2)
+		const float_t r = num/den;
+		return num/2*numeric::ln(r) + log_power(x, num/2) - (num + den)/2*numeric::log1p(r*x) - lb;
+	}
+
+	template <typename float_t> float_t df(float_t x, float_t num, float_t den, bool log=false)
 	{
+		if (log) return fisher_log_density(x, num, den, numeric::lbeta(num/2, den/2));
 		float_t y = x*num/den;
 		float_t p = numeric::pow(y, num/2);
 		float_t q = numeric::pow(1 + y, -(num + den)/2);
 		return p*q/numeric::beta(num/2, den/2)/(x?x:1);
 	}
 
-	template <typename float_t> float_t pf(float_t x, float_t num, float_t den)
+	template <typename float_t> float_t pf(float_t x, float_t num, float_t den, bool lower=true, bool log=false)
+	{
+		return pbeta(num*x/(num*x + den), num/2, den/2, lower, log);
+	}
+
+	/// The quantile of the Fisher distribution, given lb = lbeta(num/2, den/2)
+	template <typename float_t> float_t fisher_quantile(float_t p, float_t num, float_t den, float_t lb)
+	{
+		// With y = num x/(num x + den) of the beta distribution, x = den y/(num (1 - y)), and above a half 1 - y is solved for directly
+		if (float_t(0.5) < p and p <= 1) {
+		 const float_t v = beta_quantile(1 - p, den/2, num/2, lb);
+		 return den*(1 - v)/(num*v);
+		}
+		const float_t y = beta_quantile(p, num/2, den/2, lb);
+		return den*y/(num*(1 - y));
+	}
+
+	template <typename float_t> float_t qf(float_t p, float_t num, float_t den)
+	{
+		return fisher_quantile(p, num, den, numeric::lbeta(num/2, den/2));
+	}
+
+	// Batch forms. The normal quantile has no loop in it, so its kernel runs
+	// one lane per point like those of numeric.hpp, falling back to qnorm at
+	// the ends. The others iterate on series, so what a batch saves is the
+	// work on the parameters that every point shares, such as lgamma(a).
+
+	/// Lane kernel of the standard normal quantile for p in [min, 1 - epsilon/2)
+	template <typename float_t> numeric_lane float_t qnorm_lane(float_t p)
+	{
+		const auto &c = as241<float_t>;
+		const float_t q = p - float_t(0.5);
+		const float_t r = float_t(0.180625) - q*q;
+		const float_t s = numeric::sqrt_lane(-numeric::ln_lane(q < 0 ? p : 1 - p));
+		const float_t u = s - float_t(1.6), v = s - 5;
+		// All three pieces are worked out and the numerator and denominator wanted picked before the one division, so there are no branches
+		const bool centre = std::fabs(q) <= float_t(as241_split), near = s <= 5;
+		const float_t a = q*numeric::horner(c[0], r), b = numeric::horner(c[1], r);
+		const float_t e = numeric::horner(c[2], u), f = numeric::horner(c[3], u);
+		const float_t g = numeric::horner(c[4], v), h = numeric::horner(c[5], v);
+		const float_t n = near ? e : g;
+		return (centre ? a : q < 0 ? -n : n)/(centre ? b : near ? f : h);
+	}
+
+	/// Whether p is covered by the normal quantile lane kernel
+	template <typename float_t> bool qnorm_covers(float_t p)
+	{
+		using limits = std::numeric_limits<float_t>;
+		return limits::min() <= p and p < 1;
+	}
+
+	numeric_clones inline void qnorm(std::span<const float> p, std::span<float> x, float mu=0, float sigma=1)
+	{
+		numeric::transform(p, x, qnorm_lane<float>, qnorm_covers<float>, [](float a) { return qnorm(a); });
+		for (std::size_t i = 0; i < p.size(); ++i) x[i] = mu + sigma*x[i];
+	}
+
+	numeric_clones inline void qnorm(std::span<const double> p, std::span<double> x, double mu=0, double sigma=1)
+	{
+		numeric::transform(p, x, qnorm_lane<double>, qnorm_covers<double>, [](double a) { return qnorm(a); });
+		for (std::size_t i = 0; i < p.size(); ++i) x[i] = mu + sigma*x[i];
+	}
+
+	template <typename float_t> void qgamma(std::span<const float_t> p, std::span<float_t> x, float_t a, float_t b)
+	{
+		assert(p.size() <= x.size());
+		const float_t lga = numeric::lgamma(a);
+		for (std::size_t i = 0; i < p.size(); ++i) x[i] = gamma_quantile(p[i], a, lga)/b;
+	}
+
+	template <typename float_t> void qexp(std::span<const float_t> p, std::span<float_t> x, float_t mu=1)
+	{
+		assert(p.size() <= x.size());
+		for (std::size_t i = 0; i < p.size(); ++i) x[i] = qexp(p[i], mu);
+	}
+
+	template <typename float_t> void qchisq(std::span<const float_t> p, std::span<float_t> x, float_t nu=1)
+	{
+		qgamma(p, x, nu/2, float_t(0.5));
+	}
+
+	template <typename float_t> void qbeta(std::span<const float_t> p, std::span<float_t> x, float_t a, float_t b)
+	{
+		assert(p.size() <= x.size());
+		const float_t lb = numeric::lbeta(a, b);
+		for (std::size_t i = 0; i < p.size(); ++i) x[i] = beta_quantile(p[i], a, b, lb);
+	}
+
+	template <typename float_t> void qf(std::span<const float_t> p, std::span<float_t> x, float_t num, float_t den)
 	{
-		return 1 - pbeta(num/(den + num*x), den/2, num/2);
+		assert(p.size() <= x.size());
+		const float_t lb = numeric::lbeta(num/2, den/2);
+		for (std::size_t i = 0; i < p.size(); ++i) x[i] = fisher_quantile(p[i], num, den, lb);
 	}
 
+	// Random variates are drawn from the counters of numeric::philox, one
+	// index to each, so that every variate is a function of the generator and
+	// its index alone. A span of them comes out the same whether it is drawn
+	// whole, split between threads, or one at a time. A variate takes the
+	// blocks of its rounds in turn for as long as its rejection method needs.
+	//
+	// The normal and exponential are the ziggurats of Marsaglia and Tsang, in
+	// which nearly every draw lands inside a rectangle and is taken for one
+	// block, a multiplication and a comparison. The gamma is Marsaglia and
+	// Tsang's transform of a normal, whose squeeze takes nearly all of them
+	// without a logarithm. The others are built from these. The batch forms
+	// work out the blocks and the common case for a run of indices one lane
+	// each, and draw only the few lanes outside of it again by the scalar
+	// method, which comes to the same variate since it draws the same blocks.
+	// That holds to the bit only where multiply-adds are not fused, since the
+	// clones for wider registers could fuse them where the scalar forms do
+	// not, so contraction is turned off for this section whatever the flags.
+
+#if defined(__clang__)
+#pragma clang fp contract(off)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC optimize("fp-contract=off")
+#endif
+
+	/// The 256 layers of a ziggurat under a decreasing density, with the right edges x of the layers and the density f there, x[0] being the width of the base strip that holds the tail
+	template <typename float_t> struct ziggurat
+	{
+		std::array<float_t, 257> x, f;
+	};
+
+	/// The ziggurat of density f with inverse g, whose base rectangle ends at r, for layers of area v
+	template <typename float_t, typename density, typename inverse>
+	constexpr ziggurat<float_t> make_ziggurat(density f, inverse g, long double r, long double v)
+	{
+		ziggurat<float_t> z { };
+		z.x[0] = float_t(v/f(r));
+		long double x = r;
+		for (int i = 1; i < 256; ++i) {
+		 z.x[i] = float_t(x);
+		 z.f[i] = float_t(f(x));
+		 // Each layer has the width that gives it the area v on top of the last
+		 if (i < 255) x = g(v/x + f(x));
+		}
+		z.f[256] = 1;
+		return z;
+	}
+
+	/// Where the base rectangle of 256 layers under exp(-x^2/2) ends, from Marsaglia and Tsang
+	constexpr long double normal_edge = 3.6541528853610088L;
+
+	template <typename float_t> constexpr auto normal_ziggurat = make_ziggurat<float_t>(
+		[](long double x) { return numeric::exp(-x*x/2); },
+		[](long double y) { return numeric::sqrt(-2*numeric::ln(y)); },
+		normal_edge, normal_edge*numeric::exp(-normal_edge*normal_edge/2) + numeric::sqrt(numeric::pi/2)*numeric::erfc(normal_edge/numeric::sqrt2)
+	);
+
+	/// Where the base rectangle of 256 layers under exp(-x) ends
+	constexpr long double exponential_edge = 7.69711747013104972L;
+
+	template <typename float_t> constexpr auto exponential_ziggurat = make_ziggurat<float_t>(
+		[](long double x) { return numeric::exp(-x); },
+		[](long double y) { return -numeric::ln(y); },
+		exponential_edge, (exponential_edge + 1)*numeric::exp(-exponential_edge)
+	);
+
+	/// A standard normal variate from the draws
+	template <typename float_t> float_t normal_variate(numeric::philox_draws &draw)
+	{
+		const auto &t = normal_ziggurat<float_t>;
+		for (;;) {
+		 // The first words place it along the layer, the third picks the layer and the sign
+		 const auto w = draw();
+		 const unsigned k = w[2] & 255;
+		 const bool negative = w[2] & 256;
+		 const float_t z = numeric::uniform<float_t>(w[0], w[1])*t.x[k];
+		 if (z < t.x[k + 1]) return negative ? -z : z;
+		 if (0 == k) {
+		  // Beyond the base rectangle by Marsaglia's method for the tail
+		  for (;;) {
+		   const auto v = draw();
+		   const float_t a = -numeric::ln(numeric::uniform_open<float_t>(v[0], v[1]))/t.x[1];
+		   const float_t b = -numeric::ln(numeric::uniform_open<float_t>(v[2], v[3]));
+		   if (a*a < 2*b) return negative ? -(t.x[1] + a) : t.x[1] + a;
+		  }
+		 }
+		 // In the wedge over the density it is taken if under it, by the bits not yet used
+		 const float_t e = numeric::uniform<float_t>(w[3], w[2]);
+		 if (t.f[k] + e*(t.f[k + 1] - t.f[k]) < numeric::exp(-z*z/2)) return negative ? -z : z;
+		}
+	}
+
+	/// A standard exponential variate from the draws
+	template <typename float_t> float_t exponential_variate(numeric::philox_draws &draw)
+	{
+		const auto &t = exponential_ziggurat<float_t>;
+		for (;;) {
+		 const auto w = draw();
+		 const unsigned k = w[2] & 255;
+		 const float_t z = numeric::uniform<float_t>(w[0], w[1])*t.x[k];
+		 if (z < t.x[k + 1]) return z;
+		 // The tail is without memory, so beyond the base rectangle it is the edge more than another variate
+		 if (0 == k) return t.x[1] - numeric::ln(numeric::uniform_open<float_t>(w[3], w[2]));
+		 const float_t e = numeric::uniform<float_t>(w[3], w[2]);
+		 if (t.f[k] + e*(t.f[k + 1] - t.f[k]) < numeric::exp(-z)) return z;
+		}
+	}
+
+	/// A gamma variate of shape a and unit rate from the draws
+	template <typename float_t> float_t gamma_variate(numeric::philox_draws &draw, float_t a)
+	{
+		// Below 1 the shape is raised by one and the variate scaled by U^(1/a)
+		const bool small = a < 1;
+		const float_t d = (small ? a + 1 : a) - float_t(1)/3;
+		const float_t c = 1/numeric::sqrt(9*d);
+		for (;;) {
+		 const float_t x = normal_variate<float_t>(draw);
+		 const float_t t = 1 + c*x;
+		 if (t <= 0) continue;
+		 const float_t v = t*t*t;
+		 const auto w = draw();
+		 const float_t u = numeric::uniform_open<float_t>(w[0], w[1]);
+		 const float_t x2 = x*x;
+		 if (u < 1 - float_t(0.0331)*x2*x2 or numeric::ln(u) < x2/2 + d*(1 - v + numeric::ln(v))) {
+		  // The lane kernels of the logarithm and exponential, so that the batch form comes to the same bits
+		  return small ? d*v*numeric::exp_lane(numeric::ln_lane(numeric::uniform_open<float_t>(w[2], w[3]))/a) : d*v;
+		 }
+		}
+	}
+
+	template <typename float_t = double> float_t rnorm(const numeric::philox &g, std::uint64_t i, float_t mu=0, float_t sigma=1)
+	{
+		numeric::philox_draws draw(g, i);
+		return mu + sigma*normal_variate<float_t>(draw);
+	}
+
+	template <typename float_t = double> float_t rexp(const numeric::philox &g, std::uint64_t i, float_t mu=1)
+	{
+		numeric::philox_draws draw(g, i);
+		return mu*exponential_variate<float_t>(draw);
+	}
+
+	template <typename float_t> float_t rgamma(const numeric::philox &g, std::uint64_t i, float_t a, float_t b)
+	{
+		numeric::philox_draws draw(g, i);
+		return gamma_variate(draw, a)/b;
+	}
+
+	template <typename float_t = double> float_t rchisq(const numeric::philox &g, std::uint64_t i, float_t nu=1)
+	{
+		numeric::philox_draws draw(g, i);
+		return 2*gamma_variate(draw, nu/2);
+	}
+
+	template <typename float_t> float_t rbeta(const numeric::philox &g, std::uint64_t i, float_t a, float_t b)
+	{
+		// X/(X + Y) of gammas of shapes a and b, drawn from two parts of the rounds of i
+		numeric::philox_draws first(g, i, 0), second(g, i, 1);
+		const float_t x = gamma_variate(first, a);
+		const float_t y = gamma_variate(second, b);
+		return x/(x + y);
+	}
+
+	template <typename float_t> float_t rf(const numeric::philox &g, std::uint64_t i, float_t num, float_t den)
+	{
+		// The ratio of chi-squared variates over their degrees of freedom, whose factors of 2 cancel
+		numeric::philox_draws first(g, i, 0), second(g, i, 1);
+		const float_t x = gamma_variate(first, num/2);
+		const float_t y = gamma_variate(second, den/2);
+		return den*x/(num*y);
+	}
+
+	/// Lane kernel of the standard normal variate of round r of index i, which is that of normal_variate where ok
+	template <typename float_t> numeric_lane float_t normal_lane(const numeric::philox &g, std::uint64_t i, std::uint32_t r, bool &ok)
+	{
+		const auto &t = normal_ziggurat<float_t>;
+		const auto w = g(i, r);
+		const unsigned k = w[2] & 255;
+		const float_t z = numeric::uniform<float_t>(w[0], w[1])*t.x[k];
+		ok = z < t.x[k + 1];
+		return w[2] & 256 ? -z : z;
+	}
+
+	/// Lane kernel of the standard exponential variate of index i, which is that of exponential_variate where ok
+	template <typename float_t> numeric_lane float_t exponential_lane(const numeric::philox &g, std::uint64_t i, bool &ok)
+	{
+		const auto &t = exponential_ziggurat<float_t>;
+		const auto w = g(i);
+		const unsigned k = w[2] & 255;
+		const float_t z = numeric::uniform<float_t>(w[0], w[1])*t.x[k];
+		ok = z < t.x[k + 1];
+		return z;
+	}
+
+	/// Lane kernel of the gamma variate of index i and part of its rounds, for d and c of gamma_variate, which is that of gamma_variate where ok
+	template <typename float_t, bool small> numeric_lane float_t gamma_lane(const numeric::philox &g, std::uint64_t i, std::uint32_t part, float_t a, float_t d, float_t c, bool &ok)
+	{
+		bool normal;
+		const float_t x = normal_lane<float_t>(g, i, part << 24, normal);
+		const auto w = g(i, (part << 24) + 1);
+		const float_t t = 1 + c*x;
+		const float_t v = t*t*t;
+		const float_t u = numeric::uniform_open<float_t>(w[0], w[1]);
+		const float_t x2 = x*x;
+		// Only the squeeze, the logarithms of its complement being left to the scalar method
+		ok = normal & (0 < t) & (u < 1 - float_t(0.0331)*x2*x2);
+		if constexpr (small) return d*v*numeric::exp_lane(numeric::ln_lane(numeric::uniform_open<float_t>(w[2], w[3]))/a);
+		else return d*v;
+	}
+
+	/// Lanes of variates that are run together, enough that they are not unrolled
+	constexpr std::size_t variate_block = 64;
+
+	/// Standard normal variates of indices first on into y
+	template <typename float_t> numeric_lane void normal_variates(const numeric::philox &g, std::span<float_t> y, std::uint64_t first)
+	{
+		constexpr std::size_t m = variate_block;
+		for (std::size_t j = 0; j < y.size(); j += m) {
+		 const std::size_t n = std::min(m, y.size() - j);
+		 bool ok[m];
+		 for (std::size_t l = 0; l < n; ++l) y[j + l] = normal_lane<float_t>(g, first + j + l, 0, ok[l]);
+		 for (std::size_t l = 0; l < n; ++l) {
+		  if (ok[l]) continue;
+		  numeric::philox_draws draw(g, first + j + l);
+		  y[j + l] = normal_variate<float_t>(draw);
+		 }
+		}
+	}
+
+	/// Standard exponential variates of indices first on into y
+	template <typename float_t> numeric_lane void exponential_variates(const numeric::philox &g, std::span<float_t> y, std::uint64_t first)
+	{
+		constexpr std::size_t m = variate_block;
+		for (std::size_t j = 0; j < y.size(); j += m) {
+		 const std::size_t n = std::min(m, y.size() - j);
+		 bool ok[m];
+		 for (std::size_t l = 0; l < n; ++l) y[j + l] = exponential_lane<float_t>(g, first + j + l, ok[l]);
+		 for (std::size_t l = 0; l < n; ++l) {
+		  if (ok[l]) continue;
+		  numeric::philox_draws draw(g, first + j + l);
+		  y[j + l] = exponential_variate<float_t>(draw);
+		 }
+		}
+	}
+
+	/// Gamma variates of shape a and unit rate of indices first on, from the given part of their rounds, into y
+	template <typename float_t, bool small> numeric_lane void gamma_variates(const numeric::philox &g, std::span<float_t> y, float_t a, std::uint64_t first, std::uint32_t part)
+	{
+		constexpr std::size_t m = variate_block;
+		const float_t d = (small ? a + 1 : a) - float_t(1)/3;
+		const float_t c = 1/numeric::sqrt(9*d);
+		for (std::size_t j = 0; j < y.size(); j += m) {
+		 const std::size_t n = std::min(m, y.size() - j);
+		 bool ok[m];
+		 for (std::size_t l = 0; l < n; ++l) y[j + l] = gamma_lane<float_t, small>(g, first + j + l, part, a, d, c, ok[l]);
+		 for (std::size_t l = 0; l < n; ++l) {
+		  if (ok[l]) continue;
+		  numeric::philox_draws draw(g, first + j + l, part);
+		  y[j + l] = gamma_variate(draw, a);
+		 }
+		}
+	}
+
+	/// Gamma variates with the kernel for the shape
+	template <typename float_t> numeric_lane void gamma_variates(const numeric::philox &g, std::span<float_t> y, float_t a, std::uint64_t first, std::uint32_t part = 0)
+	{
+		if (a < 1) gamma_variates<float_t, true>(g, y, a, first, part);
+		else gamma_variates<float_t, false>(g, y, a, first, part);
+	}
+
+	/// Beta variates, or with ratio those of Fisher with degrees of freedom 2a and 2b, into y
+	template <typename float_t> numeric_lane void beta_variates(const numeric::philox &g, std::span<float_t> y, float_t a, float_t b, std::uint64_t first, bool ratio)
+	{
+		constexpr std::size_t m = variate_block;
+		for (std::size_t j = 0; j < y.size(); j += m) {
+		 const std::size_t n = std::min(m, y.size() - j);
+		 float_t z[m];
+		 gamma_variates(g, y.subspan(j, n), a, first + j, 0);
+		 gamma_variates(g, std::span<float_t>(z, n), b, first + j, 1);
+		 for (std::size_t l = 0; l < n; ++l) {
+		  const float_t x = y[j + l];
+		  y[j + l] = ratio ? b*x/(a*z[l]) : x/(x + z[l]);
+		 }
+		}
+	}
+
+	numeric_clones inline void rnorm(const numeric::philox &g, std::span<float> x, float mu=0, float sigma=1, std::uint64_t first=0)
+	{
+		normal_variates(g, x, first);
+		for (auto &y : x) y = mu + sigma*y;
+	}
+
+	numeric_clones inline void rnorm(const numeric::philox &g, std::span<double> x, double mu=0, double sigma=1, std::uint64_t first=0)
+	{
+		normal_variates(g, x, first);
+		for (auto &y : x) y = mu + sigma*y;
+	}
+
+	numeric_clones inline void rexp(const numeric::philox &g, std::span<float> x, float mu=1, std::uint64_t first=0)
+	{
+		exponential_variates(g, x, first);
+		for (auto &y : x) y = mu*y;
+	}
+
+	numeric_clones inline void rexp(const numeric::philox &g, std::span<double> x, double mu=1, std::uint64_t first=0)
+	{
+		exponential_variates(g, x, first);
+		for (auto &y : x) y = mu*y;
+	}
+
+	numeric_clones inline void rgamma(const numeric::philox &g, std::span<float> x, float a, float b, std::uint64_t first=0)
+	{
+		gamma_variates(g, x, a, first);
+		for (auto &y : x) y = y/b;
+	}
+
+	numeric_clones inline void rgamma(const numeric::philox &g, std::span<double> x, double a, double b, std::uint64_t first=0)
+	{
+		gamma_variates(g, x, a, first);
+		for (auto &y : x) y = y/b;
+	}
+
+	numeric_clones inline void rchisq(const numeric::philox &g, std::span<float> x, float nu=1, std::uint64_t first=0)
+	{
+		gamma_variates(g, x, nu/2, first);
+		for (auto &y : x) y = 2*y;
+	}
+
+	numeric_clones inline void rchisq(const numeric::philox &g, std::span<double> x, double nu=1, std::uint64_t first=0)
+	{
+		gamma_variates(g, x, nu/2, first);
+		for (auto &y : x) y = 2*y;
+	}
+
+	numeric_clones inline void rbeta(const numeric::philox &g, std::span<float> x, float a, float b, std::uint64_t first=0)
+	{
+		beta_variates(g, x, a, b, first, false);
+	}
+
+	numeric_clones inline void rbeta(const numeric::philox &g, std::span<double> x, double a, double b, std::uint64_t first=0)
+	{
+		beta_variates(g, x, a, b, first, false);
+	}
+
+	numeric_clones inline void rf(const numeric::philox &g, std::span<float> x, float num, float den, std::uint64_t first=0)
+	{
+		beta_variates(g, x, num/2, den/2, first, true);
+	}
+
+	numeric_clones inline void rf(const numeric::philox &g, std::span<double> x, double num, double den, std::uint64_t first=0)
+	{
+		beta_variates(g, x, num/2, den/2, first, true);
+	}
+
+#if defined(__clang__)
+#pragma clang fp contract(on)
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+	// Distributions of fixed parameters. The terms of the density and of the
+	// distribution function that depend on the parameters alone, like lgamma
+	// or lbeta, are worked out once when one is made rather than at every
+	// point, which over a whole data set is most of the cost of the functions
+	// above. The density is raised from its logarithm, so it does not overflow
+	// in its factors where it would not as a whole. The batch forms of the
+	// density run the lane kernel of its logarithm one point to a lane and
+	// fall back on the scalar form where the kernel does not cover the point.
+	// Those of the distribution and quantile functions, which iterate, loop
+	// over the scalar forms, saving the work on the parameters all the same.
+
+	/// The density and batch forms of a distribution from its logarithm of the density and its lane kernel
+	template <typename derived, typename float_t> class distribution
+	{
+		const derived &self() const
+		{
+			return static_cast<const derived &>(*this);
+		}
+
+		/// The lane kernel of the logarithm of the density, or of the density, for transform, whose loop it must be inlined into
+		template <bool raise> struct kernel
+		{
+			const derived &d;
+
+			numeric_lane float_t operator()(float_t x) const
+			{
+				if constexpr (raise) return numeric::exp_lane(d.log_lane(x));
+				else return d.log_lane(x);
+			}
+		};
+
+	public:
+
+		/// The density at x
+		float_t pdf(float_t x) const
+		{
+			return numeric::exp(self().logpdf(x));
+		}
+
+		/// The logarithm of the density at each of x into y, which may be x
+		numeric_clones void logpdf(std::span<const float_t> x, std::span<float_t> y) const
+		{
+			const derived &d = self();
+			if constexpr (numeric::has_lanes<float_t>) {
+				numeric::transform(x, y, kernel<false> { d }, [&d](float_t t) { return d.covers(t); }, [&d](float_t t) { return d.logpdf(t); });
+			} else {
+				assert(x.size() <= y.size());
+				for (std::size_t i = 0; i < x.size(); ++i) y[i] = d.logpdf(x[i]);
+			}
+		}
+
+		/// The density at each of x into y, which may be x
+		numeric_clones void pdf(std::span<const float_t> x, std::span<float_t> y) const
+		{
+			const derived &d = self();
+			if constexpr (numeric::has_lanes<float_t>) {
+				numeric::transform(x, y, kernel<true> { d }, [&d](float_t t) { return d.covers(t); }, [this](float_t t) { return pdf(t); });
+			} else {
+				assert(x.size() <= y.size());
+				for (std::size_t i = 0; i < x.size(); ++i) y[i] = pdf(x[i]);
+			}
+		}
+
+		/// The distribution function at each of x into y
+		void cdf(std::span<const float_t> x, std::span<float_t> y) const
+		{
+			assert(x.size() <= y.size());
+			for (std::size_t i = 0; i < x.size(); ++i) y[i] = self().cdf(x[i]);
+		}
+
+		/// The quantile of each of p into x
+		void quantile(std::span<const float_t> p, std::span<float_t> x) const
+		{
+			assert(p.size() <= x.size());
+			for (std::size_t i = 0; i < p.size(); ++i) x[i] = self().quantile(p[i]);
+		}
+	};
+
+	/// The normal distribution of mean mu and deviation sigma
+	template <typename float_t = double> class normal : public distribution<normal<float_t>, float_t>
+	{
+		using base = distribution<normal<float_t>, float_t>;
+
+		float_t mu, sigma, inverse, root, norm;
+
+	public:
+
+		using base::logpdf;
+
+		normal(float_t mu = 0, float_t sigma = 1)
+		: mu(mu), sigma(sigma), inverse(1/sigma), root(inverse/float_t(numeric::sqrt2)), norm(-float_t(numeric::lnsqrt2pi) - numeric::ln(sigma))
+		{ }
+
+		/// Lane kernel of the logarithm of the density, which covers any x
+		numeric_lane float_t log_lane(float_t x) const
+		{
+			const float_t z = (x - mu)*inverse;
+			return norm - z*z/2;
+		}
+
+		bool covers(float_t) const
+		{
+			return true;
+		}
+
+		float_t logpdf(float_t x) const
+		{
+			return log_lane(x);
+		}
+
+		float_t cdf(float_t x) const
+		{
+			return numeric::erfc((mu - x)*root)/2;
+		}
+
+		float_t quantile(float_t p) const
+		{
+			return mu + sigma*qnorm(p);
+		}
+
+		/// Unlike the others these have lane kernels of their own
+		numeric_clones void cdf(std::span<const float_t> x, std::span<float_t> y) const
+		{
+			if constexpr (numeric::has_lanes<float_t>) {
+				// The arguments of erfc first, which makes it the same as the scalar form and safe in place
+				assert(x.size() <= y.size());
+				for (std::size_t i = 0; i < x.size(); ++i) y[i] = (mu - x[i])*root;
+				numeric::erfc(std::span<const float_t>(y.data(), x.size()), y);
+				for (std::size_t i = 0; i < x.size(); ++i) y[i] /= 2;
+			} else {
+				base::cdf(x, y);
+			}
+		}
+
+		numeric_clones void quantile(std::span<const float_t> p, std::span<float_t> x) const
+		{
+			if constexpr (numeric::has_lanes<float_t>) {
+				numeric::transform(p, x, qnorm_lane<float_t>, qnorm_covers<float_t>, [](float_t a) { return qnorm(a); });
+				for (std::size_t i = 0; i < p.size(); ++i) x[i] = mu + sigma*x[i];
+			} else {
+				base::quantile(p, x);
+			}
+		}
+	};
+
+	/// The exponential distribution of mean mu
+	template <typename float_t = double> class exponential : public distribution<exponential<float_t>, float_t>
+	{
+		using base = distribution<exponential<float_t>, float_t>;
+
+		float_t mu, rate, norm;
+
+	public:
+
+		using base::logpdf;
+		using base::cdf;
+		using base::quantile;
+
+		exponential(float_t mu = 1)
+		: mu(mu), rate(1/mu), norm(-numeric::ln(mu))
+		{ }
+
+		/// Lane kernel of the logarithm of the density, which covers any x
+		numeric_lane float_t log_lane(float_t x) const
+		{
+			return x < 0 ? -std::numeric_limits<float_t>::infinity() : norm - x*rate;
+		}
+
+		bool covers(float_t) const
+		{
+			return true;
+		}
+
+		float_t logpdf(float_t x) const
+		{
+			return log_lane(x);
+		}
+
+		float_t cdf(float_t x) const
+		{
+			return -numeric::expm1(-std::max<float_t>(x, 0)*rate);
+		}
+
+		float_t quantile(float_t p) const
+		{
+			return qexp(p, mu);
+		}
+	};
+
+	/// The gamma distribution of shape a and rate b
+	template <typename float_t = double> class gamma : public distribution<gamma<float_t>, float_t>
+	{
+		using base = distribution<gamma<float_t>, float_t>;
+
+		float_t a, b, lga, norm, scale;
+
+		/// The logarithm of the density at x given ln(x)
+		numeric_lane float_t log_density(float_t x, float_t lx) const
+		{
+			return (1 == a ? 0 : (a - 1)*lx) - b*x + norm;
+		}
+
+	public:
+
+		using base::logpdf;
+		using base::cdf;
+		using base::quantile;
+
+		gamma(float_t a, float_t b = 1)
+		: a(a), b(b), lga(numeric::lgamma(a)), norm(a*numeric::ln(b) - lga), scale(numeric::gamma_scale(a))
+		{ }
+
+		/// Lane kernel of the logarithm of the density for normal positive x
+		numeric_lane float_t log_lane(float_t x) const
+		{
+			return log_density(x, numeric::ln_lane(x));
+		}
+
+		bool covers(float_t x) const
+		{
+			return numeric::ln_covers(x);
+		}
+
+		float_t logpdf(float_t x) const
+		{
+			if (x < 0) return -std::numeric_limits<float_t>::infinity();
+			return log_density(x, numeric::ln(x));
+		}
+
+		float_t cdf(float_t x) const
+		{
+			// That of gammap with the factor of its prefactor in a alone known
+			return numeric::gammap(a, b*x, scale);
+		}
+
+		float_t quantile(float_t p) const
+		{
+			return gamma_quantile(p, a, lga)/b;
+		}
+	};
+
+	/// The chi-squared distribution of nu degrees of freedom, that of gamma of shape nu/2 and rate 1/2
+	template <typename float_t = double> class chisq : public gamma<float_t>
+	{
+	public:
+
+		chisq(float_t nu = 1)
+		: gamma<float_t>(nu/2, float_t(0.5))
+		{ }
+	};
+
+	/// The beta distribution of shapes a and b
+	template <typename float_t = double> class beta : public distribution<beta<float_t>, float_t>
+	{
+		using base = distribution<beta<float_t>, float_t>;
+
+		float_t a, b, lb, scale;
+
+		/// The logarithm of the density given ln(x) and ln(1 - x)
+		numeric_lane float_t log_density(float_t lx, float_t ly) const
+		{
+			return (1 == a ? 0 : (a - 1)*lx) + (1 == b ? 0 : (b - 1)*ly) - lb;
+		}
+
+	public:
+
+		using base::logpdf;
+		using base::cdf;
+		using base::quantile;
+
+		beta(float_t a, float_t b)
+		: a(a), b(b), lb(numeric::lbeta(a, b)), scale(numeric::beta_scale(a, b))
+		{ }
+
+		/// Lane kernel of the logarithm of the density for normal x below 1
+		numeric_lane float_t log_lane(float_t x) const
+		{
+			return log_density(numeric::ln_lane(x), numeric::log1p_lane(-x));
+		}
+
+		bool covers(float_t x) const
+		{
+			return numeric::ln_covers(x) and x < 1;
+		}
+
+		float_t logpdf(float_t x) const
+		{
+			if (x < 0 or 1 < x) return -std::numeric_limits<float_t>::infinity();
+			return log_density(numeric::ln(x), numeric::log1p(-x));
+		}
+
+		float_t cdf(float_t x) const
+		{
+			// That of betai with the factor of its prefactor in a and b alone known
+			return numeric::betai(a, b, x, scale);
+		}
+
+		float_t quantile(float_t p) const
+		{
+			return beta_quantile(p, a, b, lb);
+		}
+	};
+
+	/// The Fisher distribution of num and den degrees of freedom
+	template <typename float_t = double> class fisher : public distribution<fisher<float_t>, float_t>
+	{
+		using base = distribution<fisher<float_t>, float_t>;
+
+		float_t num, den, ratio, lb, norm;
+		// That of num x/(num x + den), by which the distribution function is found
+		beta<float_t> y;
+
+		/// The logarithm of the density given ln(x) and ln(1 + num x/den)
+		numeric_lane float_t log_density(float_t lx, float_t ly) const
+		{
+			return (2 == num ? 0 : (num/2 - 1)*lx) - (num + den)/2*ly + norm;
+		}
+
+	public:
+
+		using base::logpdf;
+		using base::cdf;
+		using base::quantile;
+
+		fisher(float_t num, float_t den)
+		: num(num), den(den), ratio(num/den), lb(numeric::lbeta(num/2, den/2)), norm(num/2*numeric::ln(ratio) - lb), y(num/2, den/2)
+		{ }
+
+		/// Lane kernel of the logarithm of the density for normal positive x
+		numeric_lane float_t log_lane(float_t x) const
+		{
+			return log_density(numeric::ln_lane(x), numeric::log1p_lane(ratio*x));
+		}
+
+		bool covers(float_t x) const
+		{
+			return numeric::ln_covers(x) and ratio*x <= std::numeric_limits<float_t>::max();
+		}
+
+		float_t logpdf(float_t x) const
+		{
+			if (x < 0) return -std::numeric_limits<float_t>::infinity();
+			return log_density(numeric::ln(x), numeric::log1p(ratio*x));
+		}
+
+		float_t cdf(float_t x) const
+		{
+			return y.cdf(num*x/(num*x + den));
+		}
+
+		float_t quantile(float_t p) const
+		{
+			return fisher_quantile(p, num, den, lb);
+		}
+	};
+
+	// Descriptive statistics in one pass. The count, mean and central sums of
+	// the second to fourth powers are updated one value at a time by Welford's
+	// method as extended by Terriberry, and two sets of them are merged by the
+	// pairwise formulas of Chan and of Pebay, so a sample can be split among
+	// threads or shards and its parts summed up in any order. The batch form
+	// takes a block at a time in two passes over the block, the first for its
+	// mean and the second for the sums about it, each lane of a pass summing
+	// its own share so that it vectorizes without reordering the sums. The
+	// moments of the block are then merged as those of any other part.
+
+	/// The moments of a sample, with its least and greatest values
+	template <typename float_t = double> class moments
+	{
+		std::size_t n = 0;
+		float_t m = 0, m2 = 0, m3 = 0, m4 = 0;
+		float_t lo = std::numeric_limits<float_t>::infinity(), hi = -std::numeric_limits<float_t>::infinity();
+
+		/// Values of a block, and lanes summing them, enough to run the passes from cache
+		static constexpr std::size_t block = 256, lanes = 16;
+
+		/// The moments of a whole block of x
+		static moments of_block(const float_t *x)
+		{
+			float_t s[lanes] = { }, a[lanes], b[lanes];
+			for (std::size_t l = 0; l < lanes; ++l) a[l] = b[l] = x[l];
+			for (std::size_t i = 0; i < block; i += lanes) {
+			 for (std::size_t l = 0; l < lanes; ++l) {
+			  s[l] += x[i + l];
+			  a[l] = x[i + l] < a[l] ? x[i + l] : a[l];
+			  b[l] = b[l] < x[i + l] ? x[i + l] : b[l];
+			 }
+			}
+			moments r;
+			r.n = block;
+			for (std::size_t l = 0; l < lanes; ++l) {
+			 r.m += s[l];
+			 r.lo = std::min(r.lo, a[l]);
+			 r.hi = std::max(r.hi, b[l]);
+			}
+			r.m /= block;
+			float_t s1[lanes] = { }, s2[lanes] = { }, s3[lanes] = { }, s4[lanes] = { };
+			for (std::size_t i = 0; i < block; i += lanes) {
+			 for (std::size_t l = 0; l < lanes; ++l) {
+			  const float_t d = x[i + l] - r.m, d2 = d*d;
+			  s1[l] += d;
+			  s2[l] += d2;
+			  s3[l] += d2*d;
+			  s4[l] += d2*d2;
+			 }
+			}
+			float_t e = 0;
+			for (std::size_t l = 0; l < lanes; ++l) {
+			 e += s1[l];
+			 r.m2 += s2[l];
+			 r.m3 += s3[l];
+			 r.m4 += s4[l];
+			}
+			// The deviations sum to the rounding error of the mean, which corrects it and the sum of squares
+			r.m += e/block;
+			r.m2 -= e*e/block;
+			return r;
+		}
+
+	public:
+
+		/// Adds x to the sample
+		void push(float_t x)
+		{
+			const float_t n1 = float_t(n++), k = float_t(n);
+			const float_t d = x - m, dn = d/k, dn2 = dn*dn, t = d*dn*n1;
+			m += dn;
+			m4 += t*dn2*(k*k - 3*k + 3) + 6*dn2*m2 - 4*dn*m3;
+			m3 += t*dn*(k - 2) - 3*dn*m2;
+			m2 += t;
+			lo = std::min(lo, x);
+			hi = std::max(hi, x);
+		}
+
+		/// Adds each of x to the sample
+		numeric_clones void push(std::span<const float_t> x)
+		{
+			std::size_t i = 0;
+			for (; i + block <= x.size(); i += block) *this += of_block(x.data() + i);
+			for (; i < x.size(); ++i) push(x[i]);
+		}
+
+		/// Merges the sample of b into this one
+		moments &operator+=(const moments &b)
+		{
+			if (0 == b.n) return *this;
+			if (0 == n) return *this = b;
+			const float_t na = float_t(n), nb = float_t(b.n), k = na + nb;
+			const float_t d = b.m - m, dk = d/k, dk2 = dk*dk;
+			m4 += b.m4 + d*dk*dk2*na*nb*(na*na - na*nb + nb*nb) + 6*dk2*(na*na*b.m2 + nb*nb*m2) + 4*dk*(na*b.m3 - nb*m3);
+			m3 += b.m3 + d*dk2*na*nb*(na - nb) + 3*dk*(na*b.m2 - nb*m2);
+			m2 += b.m2 + d*dk*na*nb;
+			m += dk*nb;
+			n += b.n;
+			lo = std::min(lo, b.lo);
+			hi = std::max(hi, b.hi);
+			return *this;
+		}
+
+		friend moments operator+(moments a, const moments &b)
+		{
+			return a += b;
+		}
+
+		std::size_t count() const
+		{
+			return n;
+		}
+
+		/// The mean of the sample, which is not a number for an empty one
+		float_t mean() const
+		{
+			if (0 == n) return std::numeric_limits<float_t>::quiet_NaN();
+			return m;
+		}
+
+		/// The unbiased sample variance, which is not a number for fewer than two values
+		float_t variance() const
+		{
+			if (n < 2) return std::numeric_limits<float_t>::quiet_NaN();
+			return m2/float_t(n - 1);
+		}
+
+		float_t deviation() const
+		{
+			return numeric::sqrt(variance());
+		}
+
+		/// The skewness of the sample, its third central moment over the cube of its deviation by n
+		float_t skewness() const
+		{
+			if (0 == n) return std::numeric_limits<float_t>::quiet_NaN();
+			return numeric::sqrt(float_t(n))*m3/(m2*numeric::sqrt(m2));
+		}
+
+		/// The excess kurtosis of the sample, its fourth central moment over the square of its variance by n, less 3
+		float_t kurtosis() const
+		{
+			if (0 == n) return std::numeric_limits<float_t>::quiet_NaN();
+			return float_t(n)*m4/(m2*m2) - 3;
+		}
+
+		float_t min() const
+		{
+			return lo;
+		}
+
+		float_t max() const
+		{
+			return hi;
+		}
+	};
+
 }; // namespace 
 
 #endif // file